@@ -544,6 +544,16 @@ It is almost always incorrect to use the Synchronous incubation mode - elements
 want the appearance of synchronous instantiation, but without the downsides of introducing freezes
 or stutters into the application, should use the AsynchronousIfNested incubation mode.
 \endlist
+
+\note Incubation always takes place in the thread the \l{QQmlEngine} lives in. Creating
+objects, setting up their bindings and running their \c{Component.onCompleted} handlers
+requires the engine's JavaScript environment, which is not thread-safe. Asynchronous
+incubation therefore does not move work off that thread; it spreads it across several
+time slices. Loading and compiling the QML documents a component depends on already
+happens in a separate thread, before incubation starts. To keep a heavy page from
+stalling the user interface, use \l{QQmlComponent::Asynchronous} loading together with
+an asynchronous incubator, and keep expensive data preparation in a \l{WorkerScript} or
+a C++ model populated from a separate thread.
 */
 
 /*!
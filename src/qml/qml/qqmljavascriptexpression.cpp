@@ -274,19 +274,47 @@ bool QQmlJavaScriptExpression::evaluate(void **a, const QMetaType *types, int ar
     return !capture.catchException(scope) && resultIsDefined;
 }
 
+/*! \internal
+
+    Takes the guard left over from the previous evaluation that \a matches the
+    dependency being captured, or returns \nullptr if there is none.
+
+    Dependencies are usually captured in the same order on every evaluation,
+    so the match is normally the first guard. If it isn't, e.g. because a
+    conditional expression took a different branch, we only look a few guards
+    ahead. Guards skipped on the way to a match are stale and get deleted. If
+    nothing matches, the dependency is new and all remaining guards are kept,
+    so that the dependencies captured after it can still reuse them.
+*/
+template<typename Matches>
+QQmlJavaScriptExpressionGuard *QQmlPropertyCapture::takeMatchingGuard(Matches &&matches)
+{
+    constexpr int MaxGuardLookahead = 8;
+
+    QQmlJavaScriptExpressionGuard *match = guards.first();
+    for (int i = 0; match && !matches(match); ++i) {
+        if (i == MaxGuardLookahead)
+            return nullptr;
+        match = decltype(guards)::next(match);
+    }
+
+    if (!match)
+        return nullptr;
+
+    while (guards.first() != match)
+        guards.takeFirst()->Delete();
+    return guards.takeFirst();
+}
+
 void QQmlPropertyCapture::captureProperty(QQmlNotifier *n)
 {
     if (watcher->wasDeleted())
         return;
 
     Q_ASSERT(expression);
-    // Try and find a matching guard
-    while (!guards.isEmpty() && !guards.first()->isConnected(n))
-        guards.takeFirst()->Delete();
-
-    QQmlJavaScriptExpressionGuard *g = nullptr;
-    if (!guards.isEmpty()) {
-        g = guards.takeFirst();
+    QQmlJavaScriptExpressionGuard *g = takeMatchingGuard(
+            [n](QQmlJavaScriptExpressionGuard *guard) { return guard->isConnected(n); });
+    if (g) {
         g->cancelNotify();
         Q_ASSERT(g->isConnected(n));
     } else {
@@ -417,13 +445,9 @@ void QQmlPropertyCapture::captureNonBindableProperty(QObject *o, int n, int c, b
         errorString->append(error);
     } else {
 
-        // Try and find a matching guard
-        while (!guards.isEmpty() && !guards.first()->isConnected(o, n))
-            guards.takeFirst()->Delete();
-
-        QQmlJavaScriptExpressionGuard *g = nullptr;
-        if (!guards.isEmpty()) {
-            g = guards.takeFirst();
+        QQmlJavaScriptExpressionGuard *g = takeMatchingGuard(
+                [o, n](QQmlJavaScriptExpressionGuard *guard) { return guard->isConnected(o, n); });
+        if (g) {
             g->cancelNotify();
             Q_ASSERT(g->isConnected(o, n));
         } else {
@@ -208,6 +208,8 @@ public:
     QStringList *errorString;
 
 private:
+    template<typename Matches>
+    QQmlJavaScriptExpressionGuard *takeMatchingGuard(Matches &&matches);
     void captureBindableProperty(QObject *o, const QMetaObject *metaObjectForBindable, int c);
     void captureNonBindableProperty(QObject *o, int n, int c, bool doNotify);
 };
@@ -2423,7 +2423,7 @@ void QQmlJSCodeGenerator::generate_ConstructWithSpread(int func, int argc, int a
 void QQmlJSCodeGenerator::generate_SetUnwindHandler(int offset)
 {
     Q_UNUSED(offset)
-    reject(u"SetUnwindHandlerh"_s);
+    reject(u"SetUnwindHandler"_s);
 }
 
 void QQmlJSCodeGenerator::generate_UnwindDispatch()
@@ -2635,9 +2635,86 @@ void QQmlJSCodeGenerator::generate_TypeofName(int name)
     reject(u"TypeofName"_s);
 }
 
+QString QQmlJSCodeGenerator::staticTypeofResult(const QQmlJSRegisterContent &content) const
+{
+    if (content.isType() || content.isMethod() || content.isImportNamespace())
+        return QString();
+
+    if (content.isConversion()) {
+        QString result;
+        const auto origins = content.conversionOrigins();
+        for (const QQmlJSRegisterContent &origin : origins) {
+            const QString originResult = staticTypeofResult(origin);
+            if (originResult.isEmpty() || (!result.isEmpty() && result != originResult))
+                return QString();
+            result = originResult;
+        }
+        return result;
+    }
+
+    const QQmlJSScope::ConstPtr contained = content.containedType();
+    if (!contained)
+        return QString();
+    if (m_typeResolver->equals(contained, m_typeResolver->voidType()))
+        return u"undefined"_s;
+    if (m_typeResolver->equals(contained, m_typeResolver->boolType()))
+        return u"boolean"_s;
+    if (m_typeResolver->isNumeric(contained))
+        return u"number"_s;
+    if (m_typeResolver->equals(contained, m_typeResolver->stringType()))
+        return u"string"_s;
+    if (m_typeResolver->equals(contained, m_typeResolver->nullType())
+            || contained->isReferenceType()) {
+        return u"object"_s;
+    }
+
+    return QString();
+}
+
 void QQmlJSCodeGenerator::generate_TypeofValue()
 {
-    reject(u"TypeofValue"_s);
+    INJECT_TRACE_INFO(generate_TypeofValue);
+
+    const QQmlJSRegisterContent in = m_state.accumulatorIn();
+    if (const QString result = staticTypeofResult(in); !result.isEmpty()) {
+        m_body += m_state.accumulatorVariableOut + u" = "_s
+                + conversion(m_typeResolver->stringType(), m_state.accumulatorOut(),
+                             QQmlJSUtils::toLiteral(result))
+                + u";\n"_s;
+        return;
+    }
+
+    if (!m_typeResolver->equals(in.storedType(), m_typeResolver->jsPrimitiveType())) {
+        reject(u"TypeofValue on "_s + in.descriptiveName());
+        return;
+    }
+
+    // The input and output may share a variable. Determine the result before assigning it.
+    m_body += u"{\n"_s;
+    m_body += u"QString typeName;\n"_s;
+    m_body += u"switch ("_s + m_state.accumulatorVariableIn + u".type()) {\n"_s;
+    m_body += u"case QJSPrimitiveValue::Undefined:\n"_s;
+    m_body += u"    typeName = "_s + QQmlJSUtils::toLiteral(u"undefined"_s) + u";\n"_s;
+    m_body += u"    break;\n"_s;
+    m_body += u"case QJSPrimitiveValue::Null:\n"_s;
+    m_body += u"    typeName = "_s + QQmlJSUtils::toLiteral(u"object"_s) + u";\n"_s;
+    m_body += u"    break;\n"_s;
+    m_body += u"case QJSPrimitiveValue::Boolean:\n"_s;
+    m_body += u"    typeName = "_s + QQmlJSUtils::toLiteral(u"boolean"_s) + u";\n"_s;
+    m_body += u"    break;\n"_s;
+    m_body += u"case QJSPrimitiveValue::Integer:\n"_s;
+    m_body += u"case QJSPrimitiveValue::Double:\n"_s;
+    m_body += u"    typeName = "_s + QQmlJSUtils::toLiteral(u"number"_s) + u";\n"_s;
+    m_body += u"    break;\n"_s;
+    m_body += u"case QJSPrimitiveValue::String:\n"_s;
+    m_body += u"    typeName = "_s + QQmlJSUtils::toLiteral(u"string"_s) + u";\n"_s;
+    m_body += u"    break;\n"_s;
+    m_body += u"}\n"_s;
+    m_body += m_state.accumulatorVariableOut + u" = "_s
+            + conversion(m_typeResolver->stringType(), m_state.accumulatorOut(),
+                         u"std::move(typeName)"_s)
+            + u";\n"_s;
+    m_body += u"}\n"_s;
 }
 
 void QQmlJSCodeGenerator::generate_DeclareVar(int varName, int isDeletable)
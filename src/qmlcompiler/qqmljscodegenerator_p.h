@@ -312,6 +312,7 @@ private:
     void rejectIfNonQObjectOut(const QString &error);
     void rejectIfBadArray();
 
+    QString staticTypeofResult(const QQmlJSRegisterContent &content) const;
 
     QString eqIntExpression(int lhsConst);
 
@@ -70,6 +70,7 @@ class Q_QMLCOMPILER_EXPORT QQmlJSAotCompilerStats
 {
 public:
     static AotStats *instance() { return s_instance.get(); }
+    static void clear() { s_instance = std::make_unique<AotStats>(); }
 
     static bool recordAotStats() { return s_recordAotStats; }
     static void setRecordAotStats(bool recordAotStats) { s_recordAotStats = recordAotStats; }
@@ -11,6 +11,79 @@ namespace QQmlJS {
 
 using namespace Qt::StringLiterals;
 
+static bool looksLikeName(QStringView word)
+{
+    // Instruction names are quoted with double quotes, names with single quotes.
+    if (word.startsWith(u'"'))
+        return false;
+    if (word.startsWith(u'\''))
+        return true;
+    for (qsizetype i = 0; i < word.size(); ++i) {
+        const QChar c = word[i];
+        if (c.isDigit() || (i > 0 && c.isUpper()))
+            return true;
+        if (!c.isLetter() && c != u'-' && c != u'\'')
+            return true;
+    }
+    return false;
+}
+
+/*!
+    \internal
+
+    Returns the template of \a errorMessage, with the names of types, properties,
+    functions and the like replaced by a placeholder. This way the failures caused
+    by the same missing feature of the code generator are counted together. The
+    names are not delimited in the messages, so this is a heuristic.
+*/
+static QString failureReasonTemplate(const QString &errorMessage)
+{
+    // Lists of candidates and similar details follow on separate lines.
+    const QStringView firstLine = QStringView(errorMessage).left(errorMessage.indexOf(u'\n'));
+
+    // The code generator rejects unsupported instructions by name. Keep those apart.
+    constexpr QStringView rejectedInstruction = u"Cannot generate efficient code for ";
+    if (firstLine.startsWith(rejectedInstruction)
+        && !firstLine.sliced(rejectedInstruction.size()).contains(u' ')) {
+        return firstLine.toString();
+    }
+
+    static const QStringList namedBy = {
+        u"name"_s, u"property"_s, u"function"_s, u"method"_s
+    };
+    static const QStringList notNames = {
+        u"and"_s, u"for"_s, u"from"_s, u"in"_s, u"is"_s, u"of"_s, u"on"_s, u"to"_s, u"with"_s
+    };
+
+    QStringList words;
+    bool expectName = false;
+    bool first = true;
+    for (const QStringView word : firstLine.tokenize(u' ', Qt::SkipEmptyParts)) {
+        QStringView core = word;
+        while (!core.isEmpty() && QStringView(u".,:;").contains(core.back()))
+            core.chop(1);
+
+        const bool isName = !first
+                && (looksLikeName(core) || (expectName && !notNames.contains(core)));
+        expectName = namedBy.contains(core);
+        first = false;
+
+        if (!isName) {
+            words.append(word.toString());
+            continue;
+        }
+
+        // Descriptive names can span several words. Use one placeholder for all of them.
+        QString placeholder = u"<name>"_s;
+        placeholder += word.sliced(core.size());
+        if (!words.isEmpty() && words.last() == u"<name>"_s)
+            words.last() = placeholder;
+        else
+            words.append(placeholder);
+    }
+    return words.join(u' ');
+}
+
 AotStatsReporter::AotStatsReporter(const AotStats &aotstats) : m_aotstats(aotstats)
 {
     for (const auto &[moduleUri, fileEntries] : aotstats.entries().asKeyValueRange()) {
@@ -20,6 +93,13 @@ AotStatsReporter::AotStatsReporter(const AotStats &aotstats) : m_aotstats(aotsta
                 if (entry.codegenSuccessful) {
                     m_fileCounters[moduleUri][filepath].successes += 1;
                     m_successDurations.append(entry.codegenDuration);
+                } else {
+                    FailureReason &reason =
+                            m_failureReasons[failureReasonTemplate(entry.errorMessage)];
+                    reason.count += 1;
+                    // Pick the same example regardless of the order of the entries.
+                    if (reason.count == 1 || entry.errorMessage < reason.example)
+                        reason.example = entry.errorMessage;
                 }
             }
             m_moduleCounters[moduleUri].codegens += m_fileCounters[moduleUri][filepath].codegens;
@@ -88,6 +168,37 @@ void AotStatsReporter::formatSummary(QTextStream &s) const
         const auto averageDuration = totalDuration.count() / m_totalCounters.successes;
         s << u"Successful codegens took an average of %1us\n"_s.arg(averageDuration);
     }
+
+    formatFailureReasons(s);
+}
+
+void AotStatsReporter::formatFailureReasons(QTextStream &s) const
+{
+    if (m_failureReasons.isEmpty())
+        return;
+
+    QList<std::pair<QString, FailureReason>> reasons;
+    reasons.reserve(m_failureReasons.size());
+    for (const auto &[reason, failure] : m_failureReasons.asKeyValueRange())
+        reasons.append({ reason, failure });
+
+    // Most frequent first. Sort by message as well, to get a stable output.
+    std::sort(reasons.begin(), reasons.end(), [](const auto &a, const auto &b) {
+        return a.second.count != b.second.count ? a.second.count > b.second.count
+                                                : a.first < b.first;
+    });
+
+    const int failures = m_totalCounters.codegens - m_totalCounters.successes;
+    s << "Most frequent reasons for failed codegens:\n";
+    for (qsizetype i = 0, end = std::min(reasons.size(), MaxReportedFailureReasons); i < end; ++i) {
+        const auto &[reason, failure] = reasons[i];
+        s << u"  %1 (%2%3): %4\n"_s.arg(failure.count)
+                        .arg(double(failure.count) / failures * 100, 0, 'g', 4)
+                        .arg(u"%"_s)
+                        .arg(reason.isEmpty() ? u"<no error message>"_s : reason);
+        if (failure.example != reason)
+            s << u"    e.g. %1\n"_s.arg(failure.example);
+    }
 }
 
 QString AotStatsReporter::format() const
@@ -34,6 +34,7 @@ public:
 private:
     void formatDetailedStats(QTextStream &) const;
     void formatSummary(QTextStream &) const;
+    void formatFailureReasons(QTextStream &) const;
     QString formatSuccessRate(int codegens, int successes) const;
 
     const AotStats &m_aotstats;
@@ -48,6 +49,15 @@ private:
     QHash<QString, Counters> m_moduleCounters;
     QHash<QString, QHash<QString, Counters>> m_fileCounters;
     QList<std::chrono::microseconds> m_successDurations;
+
+    struct FailureReason
+    {
+        int count = 0;
+        QString example;
+    };
+    QHash<QString, FailureReason> m_failureReasons;
+
+    static constexpr qsizetype MaxReportedFailureReasons = 10;
 };
 
 } // namespace QQmlJS
@@ -12,6 +12,7 @@
 #include <QtCore/qjsonobject.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qpluginloader.h>
 #include <QtCore/qlibraryinfo.h>
 #include <QtCore/qdir.h>
@@ -34,6 +35,7 @@
 #include <QtQml/private/qqmljsdiagnosticmessage_p.h>
 
 
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
@@ -407,6 +409,12 @@ static void addJsonWarning(QJsonArray &warnings, const QQmlJS::DiagnosticMessage
 
 }
 
+QList<QQmlJS::DiagnosticMessage> QQmlJSLinter::takeGlobalWarnings()
+{
+    QList<QQmlJS::DiagnosticMessage> globalWarnings = m_importer.takeGlobalWarnings();
+    return m_globalWarningsFilter ? m_globalWarningsFilter(globalWarnings) : globalWarnings;
+}
+
 void QQmlJSLinter::processMessages(QJsonArray &warnings)
 {
     for (const auto &error : m_logger->errors())
@@ -567,15 +575,25 @@ QQmlJSLinter::LintResult QQmlJSLinter::lintFile(const QString &filename,
                     std::make_unique<QQmlJSLiteralBindingCheck>(passMan.get()), QString(),
                     QString(), QString());
 
+            // Plugins are loaded only once per process, so linters running on different threads
+            // share the plugin instances. Neither the plugins nor the passes they create are
+            // expected to be thread-safe, so those are only used with pluginMutex locked. The
+            // other passes still run in parallel.
+            static QMutex pluginMutex;
             if (m_enablePlugins) {
+                QQmlSA::PassManagerPrivate *passManPrivate =
+                        QQmlSA::PassManagerPrivate::get(passMan.get());
                 for (const Plugin &plugin : m_plugins) {
                     if (!plugin.isValid() || !plugin.isEnabled())
                         continue;
 
+                    QMutexLocker pluginLocker(&pluginMutex);
                     QQmlSA::LintPlugin *instance = plugin.m_instance;
                     Q_ASSERT(instance);
+                    passManPrivate->beginPluginPasses(&pluginMutex);
                     instance->registerPasses(passMan.get(),
                                              QQmlJSScope::createQQmlSAElement(v.result()));
+                    passManPrivate->endPluginPasses();
                 }
             }
             passMan->analyze(QQmlJSScope::createQQmlSAElement(v.result()));
@@ -605,7 +623,7 @@ QQmlJSLinter::LintResult QQmlJSLinter::lintFile(const QString &filename,
             qCompileQmlFile(filename, saveFunction, &codegen, &error, true, &interface,
                             fileContents);
 
-            QList<QQmlJS::DiagnosticMessage> globalWarnings = m_importer.takeGlobalWarnings();
+            QList<QQmlJS::DiagnosticMessage> globalWarnings = takeGlobalWarnings();
 
             if (!globalWarnings.isEmpty()) {
                 m_logger->log(QStringLiteral("Type warnings occurred while evaluating file:"),
@@ -674,7 +692,7 @@ QQmlJSLinter::LintResult QQmlJSLinter::lintModule(
     const QQmlJSImporter::ImportedTypes types = m_importer.importModule(module);
 
     QList<QQmlJS::DiagnosticMessage> importWarnings =
-            m_importer.takeGlobalWarnings() + types.warnings();
+            takeGlobalWarnings() + types.warnings();
 
     if (!importWarnings.isEmpty()) {
         m_logger->log(QStringLiteral("Warnings occurred while importing module:"), qmlImport,
@@ -26,6 +26,7 @@
 #include <QtCore/qmap.h>
 #include <QtCore/qscopedpointer.h>
 
+#include <functional>
 #include <vector>
 #include <optional>
 
@@ -131,9 +132,20 @@ public:
 
     void clearCache() { m_importer.clearCache(); }
 
+    // The importer reports problems with imported types only once, for the first file or module
+    // that uses them. Linters linting in parallel each have their own importer, and use the
+    // filter to agree on which file reports a warning.
+    using GlobalWarningsFilter = std::function<QList<QQmlJS::DiagnosticMessage>(
+            const QList<QQmlJS::DiagnosticMessage> &)>;
+    void setGlobalWarningsFilter(GlobalWarningsFilter filter)
+    {
+        m_globalWarningsFilter = std::move(filter);
+    }
+
 private:
     void parseComments(QQmlJSLogger *logger, const QList<QQmlJS::SourceLocation> &comments);
     void processMessages(QJsonArray &warnings);
+    QList<QQmlJS::DiagnosticMessage> takeGlobalWarnings();
 
     bool m_useAbsolutePath;
     bool m_enablePlugins;
@@ -141,6 +153,7 @@ private:
     QScopedPointer<QQmlJSLogger> m_logger;
     QString m_fileContents;
     std::vector<Plugin> m_plugins;
+    GlobalWarningsFilter m_globalWarningsFilter;
 };
 
 QT_END_NAMESPACE
@@ -2192,6 +2192,9 @@ void QQmlJSTypePropagator::generate_TypeofName(int name)
 
 void QQmlJSTypePropagator::generate_TypeofValue()
 {
+    // The code generator either determines the result from the type of the value or,
+    // for QJSPrimitiveValue, checks the type at run time.
+    addReadAccumulator(m_state.accumulatorIn());
     setAccumulator(m_typeResolver->operationType(m_typeResolver->stringType()));
 }
 
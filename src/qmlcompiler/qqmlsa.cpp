@@ -1061,9 +1061,18 @@ void PassManager::registerElementPass(std::unique_ptr<ElementPass> pass)
  */
 void PassManagerPrivate::registerElementPass(std::unique_ptr<ElementPass> pass)
 {
+    if (m_registeringPluginPasses)
+        m_pluginPasses.insert(pass.get());
     m_elementPasses.push_back(std::move(pass));
 }
 
+std::unique_lock<QMutex> PassManagerPrivate::lockPluginPass(const void *pass) const
+{
+    if (!m_pluginPassMutex || !m_pluginPasses.contains(pass))
+        return {};
+    return std::unique_lock<QMutex>(*m_pluginPassMutex);
+}
+
 enum LookupMode { Register, Lookup };
 static QString lookupName(const QQmlSA::Element &element, LookupMode mode = Lookup)
 {
@@ -1144,6 +1153,8 @@ bool PassManagerPrivate::registerPropertyPass(std::shared_ptr<PropertyPass> pass
 
         name = lookupName(element, Register);
     }
+    if (m_registeringPluginPasses)
+        m_pluginPasses.insert(pass.get());
     const QQmlSA::PropertyPassInfo passInfo{ propertyName.isEmpty()
                                                      ? QStringList{}
                                                      : QStringList{ propertyName.toString() },
@@ -1205,9 +1216,11 @@ void PassManagerPrivate::analyze(const Element &root)
     while (!runStack.isEmpty()) {
         auto element = runStack.takeLast();
         addBindingSourceLocations(element);
-        for (auto &elementPass : m_elementPasses)
+        for (auto &elementPass : m_elementPasses) {
+            const auto locker = lockPluginPass(elementPass.get());
             if (elementPass->shouldRun(element))
                 elementPass->run(element);
+        }
 
         for (auto it = childScopesBegin(element), end = childScopesEnd(element); it != end; ++it) {
             if ((*it)->scopeType() == QQmlSA::ScopeType::QMLScope)
@@ -1220,15 +1233,19 @@ void PassManagerPrivate::analyzeWrite(const Element &element, QString propertyNa
                                       const Element &value, const Element &writeScope,
                                       QQmlSA::SourceLocation location)
 {
-    for (PropertyPass *pass : findPropertyUsePasses(element, propertyName))
+    for (PropertyPass *pass : findPropertyUsePasses(element, propertyName)) {
+        const auto locker = lockPluginPass(pass);
         pass->onWrite(element, propertyName, value, writeScope, location);
+    }
 }
 
 void PassManagerPrivate::analyzeRead(const Element &element, QString propertyName,
                                      const Element &readScope, QQmlSA::SourceLocation location)
 {
-    for (PropertyPass *pass : findPropertyUsePasses(element, propertyName))
+    for (PropertyPass *pass : findPropertyUsePasses(element, propertyName)) {
+        const auto locker = lockPluginPass(pass);
         pass->onRead(element, propertyName, readScope, location);
+    }
 }
 
 void PassManagerPrivate::analyzeBinding(const Element &element, const QQmlSA::Element &value,
@@ -1245,14 +1262,18 @@ void PassManagerPrivate::analyzeBinding(const Element &element, const QQmlSA::El
     const QQmlSA::Binding &binding = info->second.binding;
     const QString &propertyName = info->second.fullPropertyName;
 
-    for (PropertyPass *pass : findPropertyUsePasses(element, propertyName))
+    for (PropertyPass *pass : findPropertyUsePasses(element, propertyName)) {
+        const auto locker = lockPluginPass(pass);
         pass->onBinding(element, propertyName, binding, bindingScope, value);
+    }
 
     if (!info->second.isAttached || bindingScope.baseType().isNull())
         return;
 
-    for (PropertyPass *pass : findPropertyUsePasses(bindingScope.baseType(), propertyName))
+    for (PropertyPass *pass : findPropertyUsePasses(bindingScope.baseType(), propertyName)) {
+        const auto locker = lockPluginPass(pass);
         pass->onBinding(element, propertyName, binding, bindingScope, value);
+    }
 }
 
 /*!
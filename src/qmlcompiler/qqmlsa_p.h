@@ -17,10 +17,12 @@
 #include <qtqmlcompilerexports.h>
 
 #include <private/qqmljslogger_p.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qset.h>
 #include "qqmljsmetatypes_p.h"
 
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -228,11 +230,26 @@ public:
                                    const QQmlSA::Element &scope = QQmlSA::Element(),
                                    const QString prefix = QString(), bool isAttached = false);
 
+    // Plugin instances, and so the passes they create, may be shared between pass managers
+    // running on different threads. Passes registered between beginPluginPasses() and
+    // endPluginPasses() are only run with \a mutex locked.
+    void beginPluginPasses(QMutex *mutex)
+    {
+        m_pluginPassMutex = mutex;
+        m_registeringPluginPasses = true;
+    }
+    void endPluginPasses() { m_registeringPluginPasses = false; }
+    std::unique_lock<QMutex> lockPluginPass(const void *pass) const;
+
     std::vector<std::shared_ptr<ElementPass>> m_elementPasses;
     std::multimap<QString, PropertyPassInfo> m_propertyPasses;
     std::unordered_map<quint32, BindingInfo> m_bindingsByLocation;
     QQmlJSImportVisitor *m_visitor;
     QQmlJSTypeResolver *m_typeResolver;
+
+    QSet<const void *> m_pluginPasses;
+    QMutex *m_pluginPassMutex = nullptr;
+    bool m_registeringPluginPasses = false;
 };
 
 class FixSuggestionPrivate
@@ -98,6 +98,8 @@ public:
     void setIsValid(bool newValid) { m_valid = newValid; }
     bool isInplace() const { return m_inplace; }
     void setIsInplace(bool newInplace) { m_inplace = newInplace; }
+    int jobs() const { return m_jobs; }
+    void setJobs(int newJobs) { m_jobs = newJobs; }
     bool forceEnabled() const { return m_force; }
     void setForceEnabled(bool newForce) { m_force = newForce; }
     bool ignoreSettingsEnabled() const { return m_ignoreSettings; }
@@ -124,6 +126,7 @@ private:
     QStringList m_arguments;
     QStringList m_errors;
 
+    int m_jobs = 1;
     bool m_verbose = false;
     bool m_valid = false;
     bool m_inplace = false;
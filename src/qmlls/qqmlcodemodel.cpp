@@ -647,6 +647,11 @@ void QQmlCodeModel::newDocForOpenFile(const QByteArray &url, int version, const
             setDocumentationRootPath(m_settings->value(docDir).toString());
     }
 
+    // loading is the expensive part: skip it if the client sent a newer version in the meantime,
+    // openUpdate() will pick that one up anyway
+    if (isSupersededVersion(url, version))
+        return;
+
     Path p;
     auto newCurrentPtr = newCurrent.ownerAs<DomEnvironment>();
     newCurrentPtr->loadFile(FileToLoad::fromMemory(newCurrentPtr, fPath, docText),
@@ -656,6 +661,8 @@ void QQmlCodeModel::newDocForOpenFile(const QByteArray &url, int version, const
                                 if (m_cmakeStatus == HasCMake)
                                     addFileWatches(file);
                             });
+    if (isSupersededVersion(url, version))
+        return;
     newCurrentPtr->loadPendingDependencies();
     if (p) {
         newCurrent.commitToBase(m_validEnv.ownerAs<DomEnvironment>());
@@ -708,6 +715,27 @@ void QQmlCodeModel::newDocForOpenFile(const QByteArray &url, int version, const
     emit updatedSnapshot(url);
 }
 
+/*!
+\internal
+Returns true if the open document \a url already has a version newer than \a version, in which
+case any work on \a version is wasted and can be abandoned.
+*/
+bool QQmlCodeModel::isSupersededVersion(const QByteArray &url, int version)
+{
+    QMutexLocker l(&m_mutex);
+    const auto it = m_openDocuments.constFind(url);
+    if (it == m_openDocuments.constEnd() || !it->textDocument)
+        return false;
+    QMutexLocker l2(it->textDocument->mutex());
+    const std::optional<int> current = it->textDocument->version();
+    if (current && *current > version) {
+        qCDebug(codeModelLog) << "abandoning update of" << url << "to version" << version
+                              << "superseded by version" << *current;
+        return true;
+    }
+    return false;
+}
+
 void QQmlCodeModel::closeOpenFile(const QByteArray &url)
 {
     QMutexLocker l(&m_mutex);
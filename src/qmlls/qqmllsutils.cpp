@@ -965,9 +965,22 @@ static void findUsagesOfNonJSIdentifiers(const DomItem &item, const QString &nam
 
     const DomItem qmlFiles = item.top().field(Fields::qmlFileWithPath);
     const auto filter = filterForFindUsages();
+    const auto mightContainUsages = [&namesToCheck](const DomItem &currentFile) {
+        // every usage is spelled out in the source code, so files not mentioning any of the names
+        // can be skipped without visiting (and resolving the types of) their whole Dom tree
+        const auto filePtr = currentFile.ownerAs<QmlFile>();
+        if (!filePtr || filePtr->code().isEmpty())
+            return true;
+        const QString &code = filePtr->code();
+        return std::any_of(namesToCheck.cbegin(), namesToCheck.cend(),
+                           [&code](const QString &name) { return code.contains(name); });
+    };
+
     for (const QString &file : qmlFiles.keys()) {
-        const DomItem currentFileComponents =
-                qmlFiles.key(file).field(Fields::currentItem).field(Fields::components);
+        const DomItem currentFile = qmlFiles.key(file).field(Fields::currentItem);
+        if (!mightContainUsages(currentFile))
+            continue;
+        const DomItem currentFileComponents = currentFile.field(Fields::components);
         currentFileComponents.visitTree(Path(), emptyChildrenVisitor,
                                         VisitOption::Recurse | VisitOption::VisitSelf, findUsages,
                                         emptyChildrenVisitor, filter);
@@ -0,0 +1,125 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qquickframetimings_p.h"
+
+#include <QtCore/qmath.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QQuickFrameTimings
+
+    Keeps the durations of the polish, sync, render and swap phases of the
+    last Capacity frames of a QQuickWindow, for telemetry. Recording is off by
+    default and costs a single atomic load per frame then. When enabled, the
+    render loops call recordFrame() from the thread that renders, once the
+    frame is done. The threaded render loop passes the polish duration to the
+    render thread along with the sync request.
+
+    A frame is counted as missed when the work for it, excluding the swap,
+    which usually includes waiting for vsync, took longer than one refresh
+    interval of the screen.
+*/
+
+void QQuickFrameTimings::setEnabled(bool enabled)
+{
+    m_enabled.storeRelaxed(enabled ? 1 : 0);
+}
+
+/*!
+    \internal
+    Records \a frame, which was rendered for a screen with a refresh rate of
+    \a refreshRate Hz. If the refresh rate is not known, the frame is not
+    checked for being missed.
+*/
+void QQuickFrameTimings::recordFrame(const Frame &frame, qreal refreshRate)
+{
+    const qint64 frameBudget = refreshRate > 0 ? qint64(1000000000.0 / refreshRate) : 0;
+
+    QMutexLocker locker(&m_mutex);
+    m_frames[m_next] = frame;
+    m_next = (m_next + 1) % Capacity;
+    m_count = qMin(m_count + 1, Capacity);
+
+    if (frameBudget > 0 && frame.polish + frame.sync + frame.render > frameBudget)
+        ++m_missedFrames;
+}
+
+/*!
+    \internal
+    Returns the recorded frames, oldest first.
+*/
+QList<QQuickFrameTimings::Frame> QQuickFrameTimings::frames() const
+{
+    QMutexLocker locker(&m_mutex);
+    QList<Frame> result;
+    result.reserve(m_count);
+    const qsizetype first = (m_next - m_count + Capacity) % Capacity;
+    for (qsizetype i = 0; i < m_count; ++i)
+        result.append(m_frames[(first + i) % Capacity]);
+    return result;
+}
+
+qint64 QQuickFrameTimings::duration(const Frame &frame, Phase phase)
+{
+    switch (phase) {
+    case Polish:
+        return frame.polish;
+    case Sync:
+        return frame.sync;
+    case Render:
+        return frame.render;
+    case Swap:
+        return frame.swap;
+    case Total:
+        return frame.polish + frame.sync + frame.render + frame.swap;
+    }
+    Q_UNREACHABLE_RETURN(0);
+}
+
+/*!
+    \internal
+    Returns the duration of \a phase that \a percent percent of the recorded
+    frames did not exceed, using the nearest-rank method. For example, a
+    \a percent of 50 gives the median, and 99 the duration only the slowest
+    frames took longer than. Returns 0 if no frames were recorded.
+*/
+qint64 QQuickFrameTimings::percentile(Phase phase, qreal percent) const
+{
+    QVarLengthArray<qint64, Capacity> durations;
+    {
+        QMutexLocker locker(&m_mutex);
+        for (qsizetype i = 0; i < m_count; ++i)
+            durations.append(duration(m_frames[i], phase));
+    }
+    if (durations.isEmpty())
+        return 0;
+
+    const qsizetype rank = qBound(qsizetype(0),
+                                  qsizetype(qCeil(qBound(qreal(0), percent, qreal(100)) / 100
+                                                  * durations.size())) - 1,
+                                  durations.size() - 1);
+    std::nth_element(durations.begin(), durations.begin() + rank, durations.end());
+    return durations[rank];
+}
+
+int QQuickFrameTimings::missedFrameCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_missedFrames;
+}
+
+void QQuickFrameTimings::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_next = 0;
+    m_count = 0;
+    m_missedFrames = 0;
+}
+
+QT_END_NAMESPACE
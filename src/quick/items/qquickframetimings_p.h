@@ -0,0 +1,71 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QQUICKFRAMETIMINGS_P_H
+#define QQUICKFRAMETIMINGS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmutex.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICK_EXPORT QQuickFrameTimings
+{
+public:
+    // All durations are in nanoseconds.
+    struct Frame {
+        qint64 polish = 0;
+        qint64 sync = 0;
+        qint64 render = 0;
+        qint64 swap = 0;
+    };
+
+    enum Phase {
+        Polish,
+        Sync,
+        Render,
+        Swap,
+        Total
+    };
+
+    static constexpr qsizetype Capacity = 256;
+
+    bool isEnabled() const { return m_enabled.loadRelaxed(); }
+    void setEnabled(bool enabled);
+
+    void recordFrame(const Frame &frame, qreal refreshRate);
+
+    QList<Frame> frames() const;
+    qint64 percentile(Phase phase, qreal percent) const;
+    int missedFrameCount() const;
+    void clear();
+
+private:
+    static qint64 duration(const Frame &frame, Phase phase);
+
+    QAtomicInt m_enabled = 0;
+
+    mutable QMutex m_mutex;
+    Frame m_frames[Capacity];
+    qsizetype m_next = 0;
+    qsizetype m_count = 0;
+    int m_missedFrames = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKFRAMETIMINGS_P_H
@@ -808,6 +808,49 @@ QString QQuickGraphicsConfiguration::pipelineCacheLoadFile() const
     return d->pipelineCacheLoadFile;
 }
 
+/*!
+    When enabled, the scene graph renderer prepares the shaders of the
+    materials used by the built-in rectangle and image items on a worker
+    thread, as soon as the renderer of the QQuickWindow is created. The first
+    frames then do not have to load and process those shaders on the render
+    thread, which can reduce the time until the first frame is shown.
+
+    This does not cover text, or materials provided by applications and other
+    modules, and it does not create the graphics pipelines themselves. To
+    avoid the pipeline creation costs in future runs of the application, see
+    \l{Pipeline Cache Save and Load}.
+
+    By default this is disabled. Calling this function with \a enable set to
+    true is equivalent to setting the environment variable
+    \c{QSG_PREWARM_SHADERS} to a non-zero value.
+
+    \since 6.9
+
+    \sa isShaderPrewarmingEnabled()
+ */
+void QQuickGraphicsConfiguration::setShaderPrewarming(bool enable)
+{
+    if (d->flags.testFlag(QQuickGraphicsConfigurationPrivate::PrewarmShaders) != enable) {
+        detach();
+        d->flags.setFlag(QQuickGraphicsConfigurationPrivate::PrewarmShaders, enable);
+    }
+}
+
+/*!
+    \return true if the shaders of the built-in materials are prepared ahead
+    of time.
+
+    By default the value is false.
+
+    \since 6.9
+
+    \sa setShaderPrewarming()
+ */
+bool QQuickGraphicsConfiguration::isShaderPrewarmingEnabled() const
+{
+    return d->flags.testFlag(QQuickGraphicsConfigurationPrivate::PrewarmShaders);
+}
+
 QQuickGraphicsConfigurationPrivate::QQuickGraphicsConfigurationPrivate()
     : ref(1)
 {
@@ -840,6 +883,10 @@ QQuickGraphicsConfigurationPrivate::QQuickGraphicsConfigurationPrivate()
     if (autoPipelineCache)
         flags |= AutoPipelineCache;
 
+    static const bool prewarmShaders = qEnvironmentVariableIntValue("QSG_PREWARM_SHADERS");
+    if (prewarmShaders)
+        flags |= PrewarmShaders;
+
     static const QString pipelineCacheSaveFileEnv = qEnvironmentVariable("QSG_RHI_PIPELINE_CACHE_SAVE");
     pipelineCacheSaveFile = pipelineCacheSaveFileEnv;
 
@@ -868,6 +915,7 @@ QDebug operator<<(QDebug dbg, const QQuickGraphicsConfiguration &config)
                   << " flag-isDebugMarkersEnabled=" << config.isDebugMarkersEnabled()
                   << " flag-prefersSoftwareDevice=" << config.prefersSoftwareDevice()
                   << " flag-isAutomaticPipelineCacheEnabled=" << config.isAutomaticPipelineCacheEnabled()
+                  << " flag-isShaderPrewarmingEnabled=" << config.isShaderPrewarmingEnabled()
                   << " pipelineCacheSaveFile=" << cd->pipelineCacheSaveFile
                   << " piplineCacheLoadFile=" << cd->pipelineCacheLoadFile
                   << " extra-device-extension-requests=" << cd->deviceExtensions
@@ -49,6 +49,9 @@ public:
     void setPipelineCacheLoadFile(const QString &filename);
     QString pipelineCacheLoadFile() const;
 
+    void setShaderPrewarming(bool enable);
+    bool isShaderPrewarmingEnabled() const;
+
 private:
     void detach();
     QQuickGraphicsConfigurationPrivate *d;
@@ -22,6 +22,7 @@
 #include <QtQuick/private/qquickrendertarget_p.h>
 #include <QtQuick/private/qquickgraphicsdevice_p.h>
 #include <QtQuick/private/qquickgraphicsconfiguration_p.h>
+#include <QtQuick/private/qquickframetimings_p.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickwindow.h>
 
@@ -237,6 +238,8 @@ public:
 
     QQuickGraphicsConfiguration graphicsConfig;
 
+    QQuickFrameTimings frameTimings;
+
     mutable QQuickWindowIncubationController *incubationController;
 
     static bool defaultAlphaBuffer;
@@ -8,16 +8,25 @@
 #include <qmath.h>
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 #include <QtCore/QtNumeric>
 
 #include <QtGui/QGuiApplication>
 
+#include <QtQuick/qsgtexturematerial.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
+
 #include <private/qnumeric_p.h>
+#include <private/qsimd_p.h>
 #include "qsgmaterialshader_p.h"
 
 #include "qsgrhivisualizer_p.h"
 
 #include <algorithm>
+#include <atomic>
 
 QT_BEGIN_NAMESPACE
 
@@ -208,6 +217,36 @@ void qsg_setMultiViewFlagsOnMaterial(QSGMaterial *material, int multiViewCount)
     material->setFlag(QSGMaterial::MultiView4, multiViewCount == 4);
 }
 
+static void qsg_initializeShader(ShaderManager::Shader *shader, QSGMaterialShader *s,
+                                 const QSGGeometry *geometry, bool batchable)
+{
+    shader->materialShader = s;
+    shader->inputLayout = calculateVertexInputLayout(s, geometry, batchable);
+    QSGMaterialShaderPrivate *sD = QSGMaterialShaderPrivate::get(s);
+    if (batchable) {
+        shader->stages = {
+            { QRhiShaderStage::Vertex, sD->shader(QShader::VertexStage), QShader::BatchableVertexShader },
+            { QRhiShaderStage::Fragment, sD->shader(QShader::FragmentStage) }
+        };
+    } else {
+        shader->stages = {
+            { QRhiShaderStage::Vertex, sD->shader(QShader::VertexStage) },
+            { QRhiShaderStage::Fragment, sD->shader(QShader::FragmentStage) }
+        };
+    }
+
+    shader->lastOpacity = 0;
+}
+
+// A multiViewCount of 0 and 1 both mean no multiview, see
+// qsg_setMultiViewFlagsOnMaterial(), and must map to the same shader.
+static inline ShaderKey qsg_shaderKey(QSGMaterialType *type,
+                                      QSGRendererInterface::RenderMode renderMode,
+                                      int multiViewCount)
+{
+    return { type, renderMode, qMax(1, multiViewCount) };
+}
+
 ShaderManager::Shader *ShaderManager::prepareMaterial(QSGMaterial *material,
                                                       const QSGGeometry *geometry,
                                                       QSGRendererInterface::RenderMode renderMode,
@@ -215,24 +254,18 @@ ShaderManager::Shader *ShaderManager::prepareMaterial(QSGMaterial *material,
 {
     qsg_setMultiViewFlagsOnMaterial(material, multiViewCount);
 
-    QSGMaterialType *type = material->type();
-    ShaderKey key = { type, renderMode, multiViewCount };
+    const ShaderKey key = qsg_shaderKey(material->type(), renderMode, multiViewCount);
     Shader *shader = rewrittenShaders.value(key, nullptr);
     if (shader)
         return shader;
 
-    shader = new Shader;
-    QSGMaterialShader *s = static_cast<QSGMaterialShader *>(material->createShader(renderMode));
-    context->initializeRhiShader(s, QShader::BatchableVertexShader);
-    shader->materialShader = s;
-    shader->inputLayout = calculateVertexInputLayout(s, geometry, true);
-    QSGMaterialShaderPrivate *sD = QSGMaterialShaderPrivate::get(s);
-    shader->stages = {
-        { QRhiShaderStage::Vertex, sD->shader(QShader::VertexStage), QShader::BatchableVertexShader },
-        { QRhiShaderStage::Fragment, sD->shader(QShader::FragmentStage) }
-    };
-
-    shader->lastOpacity = 0;
+    shader = takePrewarmedShader(key, true);
+    if (!shader) {
+        shader = new Shader;
+        QSGMaterialShader *s = static_cast<QSGMaterialShader *>(material->createShader(renderMode));
+        context->initializeRhiShader(s, QShader::BatchableVertexShader);
+        qsg_initializeShader(shader, s, geometry, true);
+    }
 
     rewrittenShaders[key] = shader;
     return shader;
@@ -245,30 +278,142 @@ ShaderManager::Shader *ShaderManager::prepareMaterialNoRewrite(QSGMaterial *mate
 {
     qsg_setMultiViewFlagsOnMaterial(material, multiViewCount);
 
-    QSGMaterialType *type = material->type();
-    ShaderKey key = { type, renderMode, multiViewCount };
+    const ShaderKey key = qsg_shaderKey(material->type(), renderMode, multiViewCount);
     Shader *shader = stockShaders.value(key, nullptr);
     if (shader)
         return shader;
 
-    shader = new Shader;
-    QSGMaterialShader *s = static_cast<QSGMaterialShader *>(material->createShader(renderMode));
-    context->initializeRhiShader(s, QShader::StandardShader);
-    shader->materialShader = s;
-    shader->inputLayout = calculateVertexInputLayout(s, geometry, false);
-    QSGMaterialShaderPrivate *sD = QSGMaterialShaderPrivate::get(s);
-    shader->stages = {
-        { QRhiShaderStage::Vertex, sD->shader(QShader::VertexStage) },
-        { QRhiShaderStage::Fragment, sD->shader(QShader::FragmentStage) }
-    };
-
-    shader->lastOpacity = 0;
+    shader = takePrewarmedShader(key, false);
+    if (!shader) {
+        shader = new Shader;
+        QSGMaterialShader *s = static_cast<QSGMaterialShader *>(material->createShader(renderMode));
+        context->initializeRhiShader(s, QShader::StandardShader);
+        qsg_initializeShader(shader, s, geometry, false);
+    }
 
     stockShaders[key] = shader;
 
     return shader;
 }
 
+namespace {
+struct PrewarmThreadPool : public QThreadPool
+{
+    // One thread is enough to stay ahead of the first frames, and keeps the
+    // work away from the application's use of the global pool.
+    PrewarmThreadPool() {
+        setObjectName(QStringLiteral("QSGBatchRenderer shader preparation"));
+        setMaxThreadCount(1);
+    }
+};
+}
+
+Q_GLOBAL_STATIC(PrewarmThreadPool, qsg_prewarmThreadPool)
+
+struct ShaderManager::PrewarmedShaders
+{
+    ~PrewarmedShaders() {
+        qDeleteAll(rewrittenShaders);
+        qDeleteAll(stockShaders);
+    }
+    QMutex mutex;
+    QHash<ShaderKey, Shader *> rewrittenShaders;
+    QHash<ShaderKey, Shader *> stockShaders;
+    bool finished = false;
+};
+
+/*!
+    \internal
+
+    Starts preparing the shaders of the materials of the built-in rectangle
+    and image nodes on a worker thread, unless this has already been done
+    since the last invalidation. Text materials create their shaders based on
+    the glyph cache in use, so they cannot be prepared ahead of time.
+
+    Both variants the renderer can ask for are prepared: the stock one, used
+    for unmerged batches, and the batchable one when \a useDepthBuffer is
+    true and so merged batches use it too.
+
+    Preparing a shader involves loading and deserializing the .qsb files and
+    reflecting on the vertex inputs, which is otherwise done on the render
+    thread the first time the material type is encountered. The graphics
+    pipelines themselves are still created on the render thread.
+
+    \sa QQuickGraphicsConfiguration::setShaderPrewarming()
+*/
+void ShaderManager::startPrewarming(QSGRendererInterface::RenderMode renderMode, bool useDepthBuffer)
+{
+    if (m_prewarmed)
+        return;
+
+    struct PrewarmMaterial
+    {
+        QSGMaterial *(*create)();
+        const QSGGeometry::AttributeSet &attributes;
+    };
+    static const PrewarmMaterial materials[] = {
+        { [] () -> QSGMaterial * { return new QSGVertexColorMaterial; },
+          QSGGeometry::defaultAttributes_ColoredPoint2D() },
+        { [] () -> QSGMaterial * { return new QSGOpaqueTextureMaterial; },
+          QSGGeometry::defaultAttributes_TexturedPoint2D() },
+        { [] () -> QSGMaterial * { return new QSGTextureMaterial; },
+          QSGGeometry::defaultAttributes_TexturedPoint2D() }
+    };
+
+    qCDebug(QSG_LOG_INFO, "Preparing shaders for %d built-in materials", int(std::size(materials)));
+
+    // The worker only touches its own materials and the results, which are
+    // not handed out before being taken under the mutex in
+    // takePrewarmedShader().
+    m_prewarmed = std::make_shared<PrewarmedShaders>();
+    qsg_prewarmThreadPool()->start([renderMode, useDepthBuffer, prewarmed = m_prewarmed] {
+        for (const PrewarmMaterial &m : materials) {
+            const QSGGeometry geometry(m.attributes, 0);
+            for (bool batchable : { false, true }) {
+                if (batchable && !useDepthBuffer)
+                    break;
+                std::unique_ptr<QSGMaterial> material(m.create());
+                const ShaderKey key = qsg_shaderKey(material->type(), renderMode, 1);
+
+                Shader *shader = new Shader;
+                QSGMaterialShader *s = static_cast<QSGMaterialShader *>(material->createShader(renderMode));
+                QSGMaterialShaderPrivate::get(s)->prepare(batchable ? QShader::BatchableVertexShader
+                                                                    : QShader::StandardShader);
+                qsg_initializeShader(shader, s, &geometry, batchable);
+
+                QMutexLocker locker(&prewarmed->mutex);
+                QHash<ShaderKey, Shader *> &shaders = batchable ? prewarmed->rewrittenShaders
+                                                                : prewarmed->stockShaders;
+                if (shaders.contains(key))
+                    delete shader;
+                else
+                    shaders.insert(key, shader);
+            }
+        }
+        QMutexLocker locker(&prewarmed->mutex);
+        prewarmed->finished = true;
+    });
+}
+
+ShaderManager::Shader *ShaderManager::takePrewarmedShader(const ShaderKey &key, bool batchable)
+{
+    if (!m_prewarmed)
+        return nullptr;
+    QMutexLocker locker(&m_prewarmed->mutex);
+    Shader *shader = (batchable ? m_prewarmed->rewrittenShaders : m_prewarmed->stockShaders).take(key);
+    if (shader)
+        ++m_prewarmedShadersTaken;
+    return shader;
+}
+
+bool ShaderManager::isPrewarmingFinished() const
+{
+    if (!m_prewarmed)
+        return false;
+    QMutexLocker locker(&m_prewarmed->mutex);
+    return m_prewarmed->finished;
+}
+
 void ShaderManager::invalidated()
 {
     qDeleteAll(stockShaders);
@@ -281,6 +426,9 @@ void ShaderManager::invalidated()
 
     qDeleteAll(srbPool);
     srbPool.clear();
+
+    // A worker that is still running keeps its own reference.
+    m_prewarmed.reset();
 }
 
 void ShaderManager::clearCachedRendererData()
@@ -840,6 +988,8 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
     , m_renderMode(renderMode)
     , m_opaqueRenderList(64)
     , m_alphaRenderList(64)
+    , m_alphaOverlapGridFirst(-1)
+    , m_alphaOverlapGridEnd(0)
     , m_nextRenderOrder(0)
     , m_partialRebuild(false)
     , m_partialRebuildRoot(nullptr)
@@ -886,17 +1036,34 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
         m_shaderManager->setParent(ctx);
         QObject::connect(ctx, SIGNAL(invalidated()), m_shaderManager, SLOT(invalidated()), Qt::DirectConnection);
     }
+    if (ctx->isShaderPrewarmingEnabled())
+        m_shaderManager->startPrewarming(m_renderMode, useDepthBuffer());
 
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
     m_srbPoolThreshold = qt_sg_envInt("QSG_RENDERER_SRB_POOL_THRESHOLD", 1024);
+    m_uploadThreadCount = qt_sg_envInt("QSG_RENDERER_UPLOAD_THREADS", 1);
+    if (m_uploadThreadCount <= 0)
+        m_uploadThreadCount = QThread::idealThreadCount();
+    m_viewportCulling = qt_sg_envInt("QSG_RENDERER_VIEWPORT_CULLING", 1) != 0;
 
     if (Q_UNLIKELY(debug_build() || debug_render())) {
-        qDebug("Batch thresholds: nodes: %d vertices: %d Srb pool threshold: %d",
-               m_batchNodeThreshold, m_batchVertexThreshold, m_srbPoolThreshold);
+        qDebug("Batch thresholds: nodes: %d vertices: %d Srb pool threshold: %d Upload threads: %d",
+               m_batchNodeThreshold, m_batchVertexThreshold, m_srbPoolThreshold,
+               m_uploadThreadCount);
     }
 }
 
+bool Renderer::isShaderPrewarmingFinished() const
+{
+    return m_shaderManager->isPrewarmingFinished();
+}
+
+int Renderer::prewarmedShadersTaken() const
+{
+    return m_shaderManager->prewarmedShadersTaken();
+}
+
 static void qsg_wipeBuffer(Buffer *buffer)
 {
     delete buffer->buf;
@@ -1767,8 +1934,93 @@ void Renderer::prepareOpaqueBatches()
     }
 }
 
+void OverlapGrid::reset(const Rect &area)
+{
+    for (int cell : std::as_const(m_usedCells))
+        m_cells[cell].clear();
+    m_usedCells.clear();
+    m_unsorted.clear();
+
+    m_area = area;
+    if (canQuery(area)) {
+        // Most scenes never have alpha ranges long enough to need the grid.
+        if (m_cells.isEmpty())
+            m_cells.resize(GridSize * GridSize);
+        m_cellWidth = qMax((area.br.x - area.tl.x) / GridSize, 1.0f);
+        m_cellHeight = qMax((area.br.y - area.tl.y) / GridSize, 1.0f);
+    } else {
+        m_cellWidth = 0;
+        m_cellHeight = 0;
+    }
+}
+
+void OverlapGrid::cellRange(const Rect &r, int *x0, int *y0, int *x1, int *y1) const
+{
+    // Rects reaching beyond the grid area are clamped into the border cells,
+    // which keeps rects that intersect in at least one common cell.
+    const auto cell = [](float offset, float cellSize) {
+        return int(qBound(0.0f, offset / cellSize, float(GridSize - 1)));
+    };
+    *x0 = cell(r.tl.x - m_area.tl.x, m_cellWidth);
+    *y0 = cell(r.tl.y - m_area.tl.y, m_cellHeight);
+    *x1 = cell(r.br.x - m_area.tl.x, m_cellWidth);
+    *y1 = cell(r.br.y - m_area.tl.y, m_cellHeight);
+}
+
+void OverlapGrid::insert(const Rect &r)
+{
+    if (m_cellWidth == 0 || !canQuery(r)) {
+        m_unsorted.append(r);
+        return;
+    }
+
+    int x0, y0, x1, y1;
+    cellRange(r, &x0, &y0, &x1, &y1);
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > MaxCellsPerRect) {
+        m_unsorted.append(r);
+        return;
+    }
+
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            QList<Rect> &cell = m_cells[y * GridSize + x];
+            if (cell.isEmpty())
+                m_usedCells.append(y * GridSize + x);
+            cell.append(r);
+        }
+    }
+}
+
+bool OverlapGrid::intersects(const Rect &r) const
+{
+    Q_ASSERT(canQuery(r));
+    for (const Rect &other : m_unsorted) {
+        if (other.intersects(r))
+            return true;
+    }
+    if (m_cellWidth == 0)
+        return false;
+
+    int x0, y0, x1, y1;
+    cellRange(r, &x0, &y0, &x1, &y1);
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            for (const Rect &other : m_cells.at(y * GridSize + x)) {
+                if (other.intersects(r))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
 {
+    // Long ranges happen with many translucent elements of alternating
+    // materials, where scanning the range for each candidate gets quadratic.
+    if (last - first >= OverlapGrid::MinRangeLength && OverlapGrid::canQuery(bounds))
+        return checkOverlapUsingGrid(first, last, bounds);
+
     for (int i=first; i<=last; ++i) {
         Element *e = m_alphaRenderList.at(i);
 #if defined(QSGBATCHRENDERER_INVALIDATE_WEDGED_NODES)
@@ -1784,6 +2036,35 @@ bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
     return false;
 }
 
+/*
+ * Same as checkOverlap(), but using m_alphaOverlapGrid. Within one batch in
+ * prepareAlphaBatches(), the range only grows at its end, so the grid is kept
+ * and only the elements added to the range since the last call are inserted.
+ */
+bool Renderer::checkOverlapUsingGrid(int first, int last, const Rect &bounds)
+{
+    if (m_alphaOverlapGridFirst != first) {
+        m_alphaOverlapGrid.reset(m_alphaRenderListBounds);
+        m_alphaOverlapGridFirst = first;
+        m_alphaOverlapGridEnd = first;
+    }
+    Q_ASSERT(m_alphaOverlapGridEnd <= last + 1);
+
+    for (; m_alphaOverlapGridEnd <= last; ++m_alphaOverlapGridEnd) {
+        Element *e = m_alphaRenderList.at(m_alphaOverlapGridEnd);
+#if defined(QSGBATCHRENDERER_INVALIDATE_WEDGED_NODES)
+        if (!e || e->batch)
+#else
+        if (!e)
+#endif
+            continue;
+        Q_ASSERT(e->boundsComputed);
+        m_alphaOverlapGrid.insert(e->bounds);
+    }
+
+    return m_alphaOverlapGrid.intersects(bounds);
+}
+
 /*
  *
  * To avoid the O(n^2) checkOverlap check in most cases, we have the
@@ -1797,12 +2078,17 @@ bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
 
 void Renderer::prepareAlphaBatches()
 {
+    m_alphaRenderListBounds.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    m_alphaOverlapGridFirst = -1;
+
     for (int i=0; i<m_alphaRenderList.size(); ++i) {
         Element *e = m_alphaRenderList.at(i);
         if (!e || e->isRenderNode)
             continue;
         Q_ASSERT(!e->removed);
         e->ensureBoundsValid();
+        if (!e->boundsOutsideFloatRange && OverlapGrid::canQuery(e->bounds))
+            m_alphaRenderListBounds |= e->bounds;
     }
 
     for (int i=0; i<m_alphaRenderList.size(); ++i) {
@@ -1939,6 +2225,91 @@ static inline float calculateElementZOrder(const Element *e, qreal zRange)
  * iBase: The starting index for this element in the batch
  */
 
+/*
+ * Applies the 2D affine part of the matrix \a m to the positions of \a count
+ * vertices of \a stride bytes each, starting at \a vdata, like Pt::map().
+ * With SSE2 and NEON, the positions are transformed with vector instructions,
+ * two at a time when they are tightly packed, as with
+ * QSGGeometry::defaultAttributes_Point2D(). The compiler may contract the
+ * scalar code into fused multiply-adds, so the results can differ from it in
+ * the last bits.
+ */
+void qsg_mapPositions(char *vdata, int count, int stride, const float *m)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128 col0 = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+    const __m128 col1 = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+    const __m128 translation = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+    if (stride == int(sizeof(Pt))) {
+        for (; i + 1 < count; i += 2) {
+            const __m128 p = _mm_loadu_ps(reinterpret_cast<const float *>(vdata));
+            const __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, col0), _mm_mul_ps(y, col1)),
+                                        translation);
+            _mm_storeu_ps(reinterpret_cast<float *>(vdata), r);
+            vdata += 2 * stride;
+        }
+    }
+    for (; i < count; ++i) {
+        const __m128 p = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(vdata)));
+        const __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, col0), _mm_mul_ps(y, col1)),
+                                    translation);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(vdata), r);
+        vdata += stride;
+    }
+#elif defined(__ARM_NEON__)
+    const float col0Data[] = { m[0], m[1] };
+    const float col1Data[] = { m[4], m[5] };
+    const float translationData[] = { m[12], m[13] };
+    const float32x2_t col0 = vld1_f32(col0Data);
+    const float32x2_t col1 = vld1_f32(col1Data);
+    const float32x2_t translation = vld1_f32(translationData);
+    for (; i < count; ++i) {
+        float *pos = reinterpret_cast<float *>(vdata);
+        const float32x2_t p = vld1_f32(pos);
+        const float32x2_t r = vadd_f32(vadd_f32(vmul_lane_f32(col0, p, 0),
+                                                vmul_lane_f32(col1, p, 1)),
+                                       translation);
+        vst1_f32(pos, r);
+        vdata += stride;
+    }
+#else
+    for (; i < count; ++i) {
+        Pt *p = reinterpret_cast<Pt *>(vdata);
+        const float x = p->x;
+        const float y = p->y;
+        p->x = x * m[0] + y * m[4] + m[12];
+        p->y = x * m[1] + y * m[5] + m[13];
+        vdata += stride;
+    }
+#endif
+}
+
+void qsg_translatePositions(char *vdata, int count, int stride, float dx, float dy)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128 translation = _mm_setr_ps(dx, dy, dx, dy);
+    if (stride == int(sizeof(Pt))) {
+        for (; i + 1 < count; i += 2) {
+            float *pos = reinterpret_cast<float *>(vdata);
+            _mm_storeu_ps(pos, _mm_add_ps(_mm_loadu_ps(pos), translation));
+            vdata += 2 * stride;
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        Pt *p = reinterpret_cast<Pt *>(vdata);
+        p->x += dx;
+        p->y += dy;
+        vdata += stride;
+    }
+}
+
 void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount)
 {
     if (Q_UNLIKELY(debug_upload())) qDebug() << "  - uploading element:" << e << e->node << (void *) *vertexData << (qintptr) (*zData - *vertexData) << (qintptr) (*indexData - *vertexData);
@@ -1954,17 +2325,9 @@ void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData,
     // apply vertex transform..
     char *vdata = *vertexData + vaOffset;
     if (localx.flags() == QMatrix4x4::Translation) {
-        for (int i=0; i<vCount; ++i) {
-            Pt *p = (Pt *) vdata;
-            p->x += localxdata[12];
-            p->y += localxdata[13];
-            vdata += vSize;
-        }
+        qsg_translatePositions(vdata, vCount, vSize, localxdata[12], localxdata[13]);
     } else if (localx.flags() > QMatrix4x4::Translation) {
-        for (int i=0; i<vCount; ++i) {
-            ((Pt *) vdata)->map(localx);
-            vdata += vSize;
-        }
+        qsg_mapPositions(vdata, vCount, vSize, localxdata);
     }
 
     if (useDepthBuffer()) {
@@ -2050,21 +2413,43 @@ QMatrix4x4 qsg_matrixForRoot(Node *node)
 }
 
 void Renderer::uploadBatch(Batch *b)
+{
+    int vertexBufferSize = 0;
+    int indexBufferSize = 0;
+    if (!prepareUploadBatch(b, &vertexBufferSize, &indexBufferSize))
+        return;
+
+    map(&b->ibo, indexBufferSize, true);
+    map(&b->vbo, vertexBufferSize);
+
+    if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
+                                             << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
+                                             << " vbo:" << b->vbo.buf << ":" << b->vbo.size;
+
+    fillUploadBatch(b);
+    finishUploadBatch(b);
+}
+
+/*
+ * Decides whether \a b is merged and calculates the sizes of its vertex and
+ * index data. Returns false when there is nothing to upload.
+ */
+bool Renderer::prepareUploadBatch(Batch *b, int *vertexBufferSize, int *indexBufferSize)
 {
     // Early out if nothing has changed in this batch..
     if (!b->needsUpload) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "already uploaded...";
-        return;
+        return false;
     }
 
     if (!b->first) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "is invalid...";
-        return;
+        return false;
     }
 
     if (b->isRenderNode) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch: " << b << "is a render node...";
-        return;
+        return false;
     }
 
     // Figure out if we can merge or not, if not, then just render the batch as is..
@@ -2111,7 +2496,7 @@ void Renderer::uploadBatch(Batch *b)
     // Abort if there are no vertices in this batch.. We abort this late as
     // this is a broken usecase which we do not care to optimize for...
     if (b->vertexCount == 0 || (b->merged && b->indexCount == 0))
-        return;
+        return false;
 
     /* Allocate memory for this batch. Merged batches are divided into three separate blocks
            1. Vertex data for all elements, as they were in the QSGGeometry object, but
@@ -2135,12 +2520,19 @@ void Renderer::uploadBatch(Batch *b)
         ibufferSize = unmergedIndexSize;
     }
 
-    map(&b->ibo, ibufferSize, true);
-    map(&b->vbo, bufferSize);
+    *vertexBufferSize = bufferSize;
+    *indexBufferSize = ibufferSize;
+    return true;
+}
 
-    if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
-                                             << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
-                                             << " vbo:" << b->vbo.buf << ":" << b->vbo.size;
+/*
+ * Fills the mapped vertex and index data of \a b. This only touches the
+ * batch, its elements and their geometry, so different batches can be filled
+ * on different threads.
+ */
+void Renderer::fillUploadBatch(Batch *b)
+{
+    QSGGeometry *g = b->first->node->geometry();
 
     if (b->merged) {
         char *vertexData = b->vbo.data;
@@ -2149,7 +2541,7 @@ void Renderer::uploadBatch(Batch *b)
 
         quint16 iOffset16 = 0;
         quint32 iOffset32 = 0;
-        e = b->first;
+        Element *e = b->first;
         uint verticesInSet = 0;
         // Start a new set already after 65534 vertices because 0xFFFF may be
         // used for an always-on primitive restart with some apis (adapt for
@@ -2284,7 +2676,14 @@ void Renderer::uploadBatch(Batch *b)
         }
     }
 #endif // QT_NO_DEBUG_OUTPUT
+}
 
+/*
+ * Hands the filled vertex and index data of \a b over to the QRhi resource
+ * updates. Must be called on the render thread.
+ */
+void Renderer::finishUploadBatch(Batch *b)
+{
     unmap(&b->vbo);
     unmap(&b->ibo, true);
 
@@ -2296,6 +2695,96 @@ void Renderer::uploadBatch(Batch *b)
         b->uploadedThisFrame = true;
 }
 
+namespace {
+struct UploadThreadPool : public QThreadPool
+{
+    UploadThreadPool() { setObjectName(QStringLiteral("QSGBatchRenderer upload")); }
+};
+}
+
+Q_GLOBAL_STATIC(UploadThreadPool, qsg_uploadThreadPool)
+
+/*
+ * Uploads all opaque and alpha batches, like calling uploadBatch() for each,
+ * but fills the vertex and index data of the batches on m_uploadThreadCount
+ * threads. Each batch gets its own range in the upload pools. The data is
+ * then handed over to QRhi on the render thread, in the same order as when
+ * uploading sequentially.
+ */
+void Renderer::uploadBatchesInParallel()
+{
+    struct PendingUpload {
+        Batch *batch;
+        quint32 vertexOffset;
+        quint32 indexOffset;
+        int vertexSize;
+        int indexSize;
+    };
+    QVarLengthArray<PendingUpload, 64> uploads;
+    quint32 vertexPoolSize = 0;
+    quint32 indexPoolSize = 0;
+
+    const auto prepareBatches = [&](const QDataBuffer<Batch *> &batches) {
+        for (int i = 0; i < batches.size(); ++i) {
+            Batch *b = batches.at(i);
+            int vertexSize = 0;
+            int indexSize = 0;
+            if (!prepareUploadBatch(b, &vertexSize, &indexSize))
+                continue;
+            uploads.append({ b, vertexPoolSize, indexPoolSize, vertexSize, indexSize });
+            vertexPoolSize = aligned(vertexPoolSize + quint32(vertexSize), 16u);
+            indexPoolSize = aligned(indexPoolSize + quint32(indexSize), 16u);
+        }
+    };
+    prepareBatches(m_opaqueBatches);
+    prepareBatches(m_alphaBatches);
+
+    if (vertexPoolSize > quint32(m_vertexUploadPool.size()))
+        m_vertexUploadPool.resize(vertexPoolSize);
+    if (indexPoolSize > quint32(m_indexUploadPool.size()))
+        m_indexUploadPool.resize(indexPoolSize);
+    for (PendingUpload &upload : uploads) {
+        upload.batch->vbo.data = m_vertexUploadPool.data() + upload.vertexOffset;
+        upload.batch->vbo.size = upload.vertexSize;
+        upload.batch->ibo.data = m_indexUploadPool.data() + upload.indexOffset;
+        upload.batch->ibo.size = upload.indexSize;
+    }
+
+    const PendingUpload *uploadData = uploads.constData();
+    const qsizetype uploadCount = uploads.size();
+    std::atomic<qsizetype> nextUpload = 0;
+    const auto fillBatches = [&]() {
+        for (qsizetype i = nextUpload++; i < uploadCount; i = nextUpload++)
+            fillUploadBatch(uploadData[i].batch);
+    };
+
+    // The pool is shared by the renderers of all windows. Helpers are only
+    // started when the pool has a thread available, so a busy pool never
+    // makes the render thread wait for other windows.
+    const qsizetype maxHelpers = qMin(qsizetype(m_uploadThreadCount - 1), uploadCount - 1);
+    QSemaphore helpersDone;
+    int helperCount = 0;
+    if (maxHelpers > 0) {
+        QThreadPool *pool = qsg_uploadThreadPool();
+        if (pool->maxThreadCount() < maxHelpers)
+            pool->setMaxThreadCount(int(maxHelpers));
+        for (; helperCount < maxHelpers; ++helperCount) {
+            const bool started = pool->tryStart([&fillBatches, &helpersDone] {
+                fillBatches();
+                helpersDone.release();
+            });
+            if (!started)
+                break;
+        }
+    }
+    // The render thread works on the batches as well, instead of just waiting.
+    fillBatches();
+    helpersDone.acquire(helperCount);
+
+    for (const PendingUpload &upload : std::as_const(uploads))
+        finishUploadBatch(upload.batch);
+}
+
 void Renderer::applyClipStateToGraphicsState()
 {
     m_gstate.usesScissor = (m_currentClipState.type & ClipState::ScissorClip);
@@ -3438,6 +3927,18 @@ bool Renderer::prepareRenderUnmergedBatch(Batch *batch, PreparedRenderBatch *ren
     updateMaterialStaticData(sms, renderState,
                              material, batch, &pendingGStatePop);
 
+    // Culling relies on the element bounds, so it is skipped for geometry
+    // rasterized beyond its vertices (wide lines and points). The renderer
+    // cannot tell whether a vertex shader moves the vertices, see the
+    // material flags checked below and QSG_RENDERER_VIEWPORT_CULLING.
+    const bool canCull = m_viewportCulling
+            && m_renderMode != QSGRendererInterface::RenderMode3D
+            && viewCount == 1
+            && g->drawingMode() != QSGGeometry::DrawPoints
+            && g->drawingMode() != QSGGeometry::DrawLines
+            && g->drawingMode() != QSGGeometry::DrawLineStrip
+            && g->drawingMode() != QSGGeometry::DrawLineLoop;
+
     int ubufOffset = 0;
     QRhiGraphicsPipeline *ps = nullptr;
     QRhiGraphicsPipeline *depthPostPassPs = nullptr;
@@ -3468,6 +3969,17 @@ bool Renderer::prepareRenderUnmergedBatch(Batch *batch, PreparedRenderBatch *ren
             m_current_projection_matrix[0](2, 3) = calculateElementZOrder(e, m_zRange);
         }
 
+        // Materials getting the matrix for themselves, such as antialiased
+        // rectangles and images, move their vertices beyond the bounds.
+        // Materials that opt out of batching may do anything with them.
+        const QSGMaterial::Flags materialFlags = gn->activeMaterial()->flags();
+        e->culled = canCull
+                && !materialFlags.testFlag(QSGMaterial::RequiresFullMatrixExceptTranslate)
+                && !materialFlags.testFlag(QSGMaterial::NoBatching)
+                && isOutsideViewport(e, rootMatrix);
+        if (e->culled)
+            ++m_culledElementCount;
+
         QSGMaterialShader::RenderState renderState = state(QSGMaterialShader::RenderState::DirtyStates(int(dirty)));
         updateMaterialDynamicData(sms, renderState, material, batch, e, ubufOffset, ubufSize, directUpdatePtr);
 
@@ -3535,6 +4047,50 @@ bool Renderer::prepareRenderUnmergedBatch(Batch *batch, PreparedRenderBatch *ren
     return true;
 }
 
+static inline bool qsg_isAffine(const QMatrix4x4 &m)
+{
+    return m(3, 0) == 0 && m(3, 1) == 0 && m(3, 2) == 0 && m(3, 3) == 1;
+}
+
+/*
+ * Returns true when the bounds of \a e are completely outside of the
+ * normalized device coordinate range, i.e. when nothing of it can end up in
+ * the render target. Used to skip off-screen elements, such as the content of
+ * a large Flickable without clipping, in unmerged batches.
+ */
+bool Renderer::isOutsideViewport(Element *e, const QMatrix4x4 &rootMatrix) const
+{
+    // The bounds are calculated by mapping with only the 2D affine part of
+    // the matrices, which is not exact with perspective transforms.
+    if (!qsg_isAffine(m_current_model_view_matrix) || !qsg_isAffine(m_current_projection_matrix[0]))
+        return false;
+
+    // Only alpha elements have their bounds calculated anyway. Calculating
+    // them for every opaque element would cost more than the culling saves.
+    if (!e->boundsComputed || e->boundsOutsideFloatRange)
+        return false;
+
+    const QMatrix4x4 m = m_current_projection_matrix[0] * rootMatrix;
+    const QPointF corners[] = {
+        m.map(QPointF(e->bounds.tl.x, e->bounds.tl.y)),
+        m.map(QPointF(e->bounds.br.x, e->bounds.tl.y)),
+        m.map(QPointF(e->bounds.tl.x, e->bounds.br.y)),
+        m.map(QPointF(e->bounds.br.x, e->bounds.br.y))
+    };
+    const auto allCorners = [&corners](auto predicate) {
+        return std::all_of(std::begin(corners), std::end(corners), predicate);
+    };
+    // Keep one device pixel of margin, as antialiasing done in the fragment
+    // shader can reach a little beyond the geometry.
+    const QRect viewport = viewportRect();
+    const float marginX = 1 + 2.0f / qMax(viewport.width(), 1);
+    const float marginY = 1 + 2.0f / qMax(viewport.height(), 1);
+    return allCorners([marginX](const QPointF &p) { return p.x() < -marginX; })
+            || allCorners([marginX](const QPointF &p) { return p.x() > marginX; })
+            || allCorners([marginY](const QPointF &p) { return p.y() < -marginY; })
+            || allCorners([marginY](const QPointF &p) { return p.y() > marginY; });
+}
+
 void Renderer::renderUnmergedBatch(PreparedRenderBatch *renderBatch, bool depthPostPass)
 {
     const Batch *batch = renderBatch->batch;
@@ -3552,9 +4108,16 @@ void Renderer::renderUnmergedBatch(PreparedRenderBatch *renderBatch, bool depthP
 
     while (e) {
         QSGGeometry *g = e->node->geometry();
-        checkLineWidth(g);
         const int effectiveIndexSize = m_uint32IndexForRhi ? sizeof(quint32) : g->sizeOfIndex();
 
+        if (e->culled) {
+            vOffset += g->sizeOfVertex() * g->vertexCount();
+            iOffset += g->indexCount() * effectiveIndexSize;
+            e = e->nextInBatch;
+            continue;
+        }
+
+        checkLineWidth(g);
         setGraphicsPipeline(cb, batch, e, depthPostPass);
 
         const QRhiCommandBuffer::VertexInput vbufBinding(batch->vbo.buf, vOffset);
@@ -3807,25 +4370,34 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     m_vertexUploadPool.reset();
     m_indexUploadPool.reset();
 
-    if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
-    for (int i=0; i<m_opaqueBatches.size(); ++i) {
-        Batch *b = m_opaqueBatches.at(i);
-        uploadBatch(b);
-    }
-    if (Q_UNLIKELY(debug_render())) ctx->timeUploadOpaque = ctx->timer.restart();
+    // The visualizer keeps the data of each batch around, and the upload
+    // debug output is not meant to be interleaved, so both upload sequentially.
+    if (m_uploadThreadCount > 1 && m_visualizer->mode() == Visualizer::VisualizeNothing
+            && !debug_upload()) {
+        uploadBatchesInParallel();
+        if (Q_UNLIKELY(debug_render())) ctx->timeUploadOpaque = ctx->timeUploadAlpha = ctx->timer.restart();
+    } else {
+        if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Opaque Batches:");
+        for (int i=0; i<m_opaqueBatches.size(); ++i) {
+            Batch *b = m_opaqueBatches.at(i);
+            uploadBatch(b);
+        }
+        if (Q_UNLIKELY(debug_render())) ctx->timeUploadOpaque = ctx->timer.restart();
 
-    if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
-    for (int i=0; i<m_alphaBatches.size(); ++i) {
-        Batch *b = m_alphaBatches.at(i);
-        uploadBatch(b);
+        if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
+        for (int i=0; i<m_alphaBatches.size(); ++i) {
+            Batch *b = m_alphaBatches.at(i);
+            uploadBatch(b);
+        }
+        if (Q_UNLIKELY(debug_render())) ctx->timeUploadAlpha = ctx->timer.restart();
     }
-    if (Q_UNLIKELY(debug_render())) ctx->timeUploadAlpha = ctx->timer.restart();
 
     if (Q_UNLIKELY(debug_render())) {
         qDebug().nospace() << "Rendering:" << Qt::endl
                            << " -> Opaque: " << qsg_countNodesInBatches(m_opaqueBatches) << " nodes in " << m_opaqueBatches.size() << " batches..." << Qt::endl
                            << " -> Alpha: " << qsg_countNodesInBatches(m_alphaBatches) << " nodes in " << m_alphaBatches.size() << " batches...";
     }
+    m_culledElementCount = 0;
 
     m_current_opacity = 1;
     m_currentMaterial = nullptr;
@@ -3910,6 +4482,9 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
         }
     }
 
+    if (Q_UNLIKELY(debug_render()))
+        qDebug() << " -> Culled:" << m_culledElementCount << "elements outside of the viewport";
+
     m_rebuild = 0;
 
 #if defined(QSGBATCHRENDERER_INVALIDATE_WEDGED_NODES)
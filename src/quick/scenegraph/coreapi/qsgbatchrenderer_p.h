@@ -27,6 +27,8 @@
 #include <QtCore/QBitArray>
 #include <QtCore/QStack>
 
+#include <memory>
+
 #include <rhi/qrhi.h>
 
 QT_BEGIN_NAMESPACE
@@ -205,6 +207,11 @@ inline QDebug operator << (QDebug d, const Pt &p) {
     return d;
 }
 
+// Transform the positions of vertices in place, in uploadMergedElement().
+Q_AUTOTEST_EXPORT void qsg_mapPositions(char *vdata, int count, int stride, const float *m);
+Q_AUTOTEST_EXPORT void qsg_translatePositions(char *vdata, int count, int stride, float dx,
+                                              float dy);
+
 
 
 struct Rect {
@@ -239,7 +246,7 @@ struct Rect {
         br.set(right, bottom);
     }
 
-    bool intersects(const Rect &r) {
+    bool intersects(const Rect &r) const {
         bool xOverlap = r.tl.x < br.x && r.br.x > tl.x;
         bool yOverlap = r.tl.y < br.y && r.br.y > tl.y;
         return xOverlap && yOverlap;
@@ -258,6 +265,41 @@ inline QDebug operator << (QDebug d, const Rect &r) {
     return d;
 }
 
+/*
+ * Uniform grid over the bounds of the elements in a range of the alpha
+ * render list, used to answer overlap queries without going through the
+ * whole range. Rects which do not fit the grid well, such as very large
+ * ones, are kept in a separate list which is always checked.
+ */
+class OverlapGrid
+{
+public:
+    enum {
+        // Ranges shorter than this are cheaper to scan than to put into the grid.
+        MinRangeLength = 32,
+        GridSize = 32,
+        MaxCellsPerRect = 16
+    };
+
+    void reset(const Rect &area);
+    void insert(const Rect &r);
+    bool intersects(const Rect &r) const;
+
+    static bool canQuery(const Rect &r) {
+        return r.tl.x <= r.br.x && r.tl.y <= r.br.y;
+    }
+
+private:
+    void cellRange(const Rect &r, int *x0, int *y0, int *x1, int *y1) const;
+
+    Rect m_area;
+    float m_cellWidth = 0;
+    float m_cellHeight = 0;
+    QList<QList<Rect>> m_cells; // allocated on first use, GridSize * GridSize
+    QList<Rect> m_unsorted;
+    QList<int> m_usedCells;
+};
+
 struct Buffer {
     quint32 size;
     // Data is only valid while preparing the upload. Exception is if we are using the
@@ -276,6 +318,7 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , culled(false)
     {
     }
 
@@ -309,6 +352,7 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint culled : 1; // outside of the viewport, drawing is skipped (unmerged batches only)
 };
 
 struct RenderNodeElement : public Element {
@@ -697,9 +741,18 @@ public:
                                      QSGRendererInterface::RenderMode renderMode = QSGRendererInterface::RenderMode2D,
                                      int multiViewCount = 0);
 
+    void startPrewarming(QSGRendererInterface::RenderMode renderMode, bool useDepthBuffer);
+    bool isPrewarmingFinished() const;
+    int prewarmedShadersTaken() const { return m_prewarmedShadersTaken; }
+
 private:
+    struct PrewarmedShaders;
+    Shader *takePrewarmedShader(const ShaderKey &key, bool batchable);
+
     QHash<ShaderKey, Shader *> rewrittenShaders;
     QHash<ShaderKey, Shader *> stockShaders;
+    std::shared_ptr<PrewarmedShaders> m_prewarmed;
+    int m_prewarmedShadersTaken = 0;
 
     QSGDefaultRenderContext *context;
 };
@@ -748,6 +801,13 @@ public:
     Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMode renderMode = QSGRendererInterface::RenderMode2D);
     ~Renderer();
 
+    // Elements of the last frame that were not drawn for being outside of the viewport.
+    int culledElementCount() const { return m_culledElementCount; }
+    // Whether the shaders of the built-in materials have been prepared, and
+    // how many of them have been used instead of creating new ones.
+    bool isShaderPrewarmingFinished() const;
+    int prewarmedShadersTaken() const;
+
 protected:
     void nodeChanged(QSGNode *node, QSGNode::DirtyState state) override;
     void render() override;
@@ -808,10 +868,15 @@ private:
     void cleanupBatches(QDataBuffer<Batch *> *batches);
     void prepareOpaqueBatches();
     bool checkOverlap(int first, int last, const Rect &bounds);
+    bool checkOverlapUsingGrid(int first, int last, const Rect &bounds);
     void prepareAlphaBatches();
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
 
     void uploadBatch(Batch *b);
+    bool prepareUploadBatch(Batch *b, int *vertexBufferSize, int *indexBufferSize);
+    void fillUploadBatch(Batch *b);
+    void finishUploadBatch(Batch *b);
+    void uploadBatchesInParallel();
     void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount);
 
     bool ensurePipelineState(Element *e, const ShaderManager::Shader *sms, bool depthPostPass = false);
@@ -825,6 +890,7 @@ private:
     bool prepareRenderMergedBatch(Batch *batch, PreparedRenderBatch *renderBatch);
     void renderMergedBatch(PreparedRenderBatch *renderBatch, bool depthPostPass = false);
     bool prepareRenderUnmergedBatch(Batch *batch, PreparedRenderBatch *renderBatch);
+    bool isOutsideViewport(Element *e, const QMatrix4x4 &rootMatrix) const;
     void renderUnmergedBatch(PreparedRenderBatch *renderBatch, bool depthPostPass = false);
     void setGraphicsPipeline(QRhiCommandBuffer *cb, const Batch *batch, Element *e, bool depthPostPass = false);
     ClipState::ClipType updateStencilClip(const QSGClipNode *clip);
@@ -863,6 +929,10 @@ private:
     QSet<Node *> m_taggedRoots;
     QDataBuffer<Element *> m_opaqueRenderList;
     QDataBuffer<Element *> m_alphaRenderList;
+    OverlapGrid m_alphaOverlapGrid;
+    Rect m_alphaRenderListBounds;
+    int m_alphaOverlapGridFirst;
+    int m_alphaOverlapGridEnd;
     int m_nextRenderOrder;
     bool m_partialRebuild;
     QSGNode *m_partialRebuildRoot;
@@ -888,9 +958,13 @@ private:
     int m_renderOrderRebuildUpper;
 #endif
 
+    int m_culledElementCount = 0;
+
     int m_batchNodeThreshold;
     int m_batchVertexThreshold;
     int m_srbPoolThreshold;
+    int m_uploadThreadCount;
+    bool m_viewportCulling;
 
     Visualizer *m_visualizer;
 
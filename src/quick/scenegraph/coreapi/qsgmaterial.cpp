@@ -162,6 +162,13 @@ QSGMaterial::~QSGMaterial()
     \value CustomCompileStep In Qt 6 this flag is identical to NoBatching. Prefer using
     NoBatching instead.
 
+    \note The default renderer skips elements of unbatched geometry that are
+    completely outside of the viewport, based on the bounds of their vertices. A
+    material whose vertex shader moves the vertices beyond those bounds must set
+    RequiresFullMatrixExceptTranslate or NoBatching, otherwise such elements can be
+    wrongly left out. See \l{Qt Quick Scene Graph Default Renderer} for how to turn
+    this off.
+
     \omitvalue MultiView2
     \omitvalue MultiView3
     \omitvalue MultiView4
@@ -13,6 +13,11 @@
 
 #include <private/qquickprofiler_p.h>
 #include <QElapsedTimer>
+#include <QSemaphore>
+#include <QThreadPool>
+#include <QVarLengthArray>
+
+#include <atomic>
 
 #include <qtquick_tracepoints_p.h>
 
@@ -25,6 +30,10 @@ Q_TRACE_POINT(qtquick, QSGDistanceFieldGlyphCache_glyphRender_exit)
 Q_TRACE_POINT(qtquick, QSGDistanceFieldGlyphCache_glyphStore_entry)
 Q_TRACE_POINT(qtquick, QSGDistanceFieldGlyphCache_glyphStore_exit)
 
+#if !defined(QSG_DISTANCEFIELD_PARALLEL_GLYPH_THRESHOLD)
+#  define QSG_DISTANCEFIELD_PARALLEL_GLYPH_THRESHOLD 16
+#endif
+
 static QElapsedTimer qsg_render_timer;
 
 QSGDistanceFieldGlyphCache::Texture QSGDistanceFieldGlyphCache::s_emptyTexture;
@@ -161,22 +170,54 @@ void QSGDistanceFieldGlyphCache::update()
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphAdaptationLayerFrame);
     Q_TRACE(QSGDistanceFieldGlyphCache_glyphRender_entry);
 
-    QList<QDistanceField> distanceFields;
+    struct PendingGlyph {
+        QSize size;
+        QPainterPath path;
+        glyph_t glyph;
+    };
     const int pendingGlyphsSize = m_pendingGlyphs.size();
-    distanceFields.reserve(pendingGlyphsSize);
+    QVarLengthArray<PendingGlyph, 64> pendingGlyphs;
+    pendingGlyphs.reserve(pendingGlyphsSize);
     for (int i = 0; i < pendingGlyphsSize; ++i) {
         GlyphData &gd = glyphData(m_pendingGlyphs.at(i));
 
         QSize size = QSize(qCeil(gd.texCoord.width + gd.texCoord.xMargin * 2),
                            qCeil(gd.texCoord.height + gd.texCoord.yMargin * 2));
 
-        distanceFields.append(QDistanceField(size,
-                                             gd.path,
-                                             m_pendingGlyphs.at(i),
-                                             m_doubleGlyphResolution));
+        pendingGlyphs.append({ size, gd.path, m_pendingGlyphs.at(i) });
         gd.path = QPainterPath(); // no longer needed, so release memory used by the painter path
     }
 
+    // Rendering a distance field only reads the glyph's path, so when there
+    // are enough glyphs, spread them over idle threads of the global pool,
+    // starting one helper per QSG_DISTANCEFIELD_PARALLEL_GLYPH_THRESHOLD
+    // glyphs. The render thread takes part as well, and only threads that
+    // could be started right away are waited for.
+    QList<QDistanceField> distanceFields(pendingGlyphsSize);
+    QDistanceField *fields = distanceFields.data();
+    std::atomic<int> nextGlyph = 0;
+    auto renderGlyphs = [&] {
+        for (int i = nextGlyph++; i < pendingGlyphsSize; i = nextGlyph++) {
+            const PendingGlyph &glyph = pendingGlyphs.at(i);
+            fields[i] = QDistanceField(glyph.size,
+                                       glyph.path,
+                                       glyph.glyph,
+                                       m_doubleGlyphResolution);
+        }
+    };
+
+    int helperCount = 0;
+    QSemaphore helpersDone;
+    if (pendingGlyphsSize >= QSG_DISTANCEFIELD_PARALLEL_GLYPH_THRESHOLD) {
+        QThreadPool *pool = QThreadPool::globalInstance();
+        const int maxHelpers = qMin(pool->maxThreadCount(),
+                                    pendingGlyphsSize / QSG_DISTANCEFIELD_PARALLEL_GLYPH_THRESHOLD);
+        while (helperCount < maxHelpers && pool->tryStart([&] { renderGlyphs(); helpersDone.release(); }))
+            ++helperCount;
+    }
+    renderGlyphs();
+    helpersDone.acquire(helperCount);
+
     qint64 renderTime = 0;
     int count = m_pendingGlyphs.size();
     if (profileFrames)
@@ -27,6 +27,7 @@ QSGDefaultRenderContext::QSGDefaultRenderContext(QSGContext *context)
     , m_currentFrameCommandBuffer(nullptr)
     , m_currentFrameRenderPass(nullptr)
     , m_useDepthBufferFor2D(true)
+    , m_shaderPrewarming(false)
     , m_glyphCacheResourceUpdates(nullptr)
 {
 }
@@ -157,6 +158,7 @@ void QSGDefaultRenderContext::prepareSync(qreal devicePixelRatio,
 {
     m_currentDevicePixelRatio = devicePixelRatio;
     m_useDepthBufferFor2D = config.isDepthBufferEnabledFor2D();
+    m_shaderPrewarming = config.isShaderPrewarmingEnabled();
 
     // we store the command buffer already here, in case there is something in
     // an updatePaintNode() implementation that leads to needing it (for
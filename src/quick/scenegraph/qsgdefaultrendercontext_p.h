@@ -80,6 +80,7 @@ public:
 
     int maxTextureSize() const override { return m_maxTextureSize; }
     bool useDepthBufferFor2D() const { return m_useDepthBufferFor2D; }
+    bool isShaderPrewarmingEnabled() const { return m_shaderPrewarming; }
     int msaaSampleCount() const { return m_initParams.sampleCount; }
 
     QRhiCommandBuffer *currentFrameCommandBuffer() const {
@@ -116,6 +117,7 @@ protected:
     QRhiRenderPassDescriptor *m_currentFrameRenderPass;
     qreal m_currentDevicePixelRatio;
     bool m_useDepthBufferFor2D;
+    bool m_shaderPrewarming;
     QRhiResourceUpdateBatch *m_glyphCacheResourceUpdates;
     QSet<QRhiTexture *> m_pendingGlyphCacheTextures;
     QHash<FontKey, QSGCurveGlyphAtlas *> m_curveGlyphAtlases;
@@ -12,6 +12,7 @@
 #include <QtCore/private/qabstractanimation_p.h>
 
 #include <QtGui/QOffscreenSurface>
+#include <QtGui/QScreen>
 #include <QtGui/private/qguiapplication_p.h>
 #include <qpa/qplatformintegration.h>
 #include <QPlatformSurfaceEvent>
@@ -606,7 +607,9 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     Q_TRACE_SCOPE(QSG_renderWindow);
     QElapsedTimer renderTimer;
     qint64 renderTime = 0, syncTime = 0, polishTime = 0;
-    const bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    const bool logFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    const bool recordFrames = cd->frameTimings.isEnabled();
+    const bool profileFrames = logFrames || recordFrames;
     if (profileFrames)
         renderTimer.start();
     Q_TRACE(QSG_polishItems_entry);
@@ -738,7 +741,13 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     Q_QUICK_SG_PROFILE_END(QQuickProfiler::SceneGraphRenderLoopFrame,
                            QQuickProfiler::SceneGraphRenderLoopSwap);
 
-    if (profileFrames) {
+    if (recordFrames) {
+        cd->frameTimings.recordFrame({ polishTime, syncTime - polishTime, renderTime - syncTime,
+                                       swapTime - renderTime },
+                                     window->screen() ? window->screen()->refreshRate() : 0);
+    }
+
+    if (logFrames) {
         qCDebug(QSG_LOG_TIME_RENDERLOOP,
                 "[window %p][gui thread] syncAndRender: frame rendered in %dms, polish=%d, sync=%d, render=%d, swap=%d, perWindowFrameDelta=%d",
                 window,
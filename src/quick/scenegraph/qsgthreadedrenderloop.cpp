@@ -135,19 +135,24 @@ public:
 class WMSyncEvent : public WMWindowEvent
 {
 public:
-    WMSyncEvent(QQuickWindow *c, bool inExpose, bool force, const QRhiSwapChainProxyData &scProxyData)
+    WMSyncEvent(QQuickWindow *c, bool inExpose, bool force, const QRhiSwapChainProxyData &scProxyData,
+                qint64 polishTime, qreal refreshRate)
         : WMWindowEvent(c, QEvent::Type(WM_RequestSync))
         , size(c->size())
         , dpr(float(c->effectiveDevicePixelRatio()))
         , syncInExpose(inExpose)
         , forceRenderPass(force)
         , scProxyData(scProxyData)
+        , polishTime(polishTime)
+        , refreshRate(refreshRate)
     {}
     QSize size;
     float dpr;
     bool syncInExpose;
     bool forceRenderPass;
     QRhiSwapChainProxyData scProxyData;
+    qint64 polishTime; // for QQuickFrameTimings
+    qreal refreshRate;
 };
 
 
@@ -307,6 +312,8 @@ public:
     QSize windowSize;
     float dpr = 1;
     QRhiSwapChainProxyData scProxyData;
+    qint64 polishTime = 0;
+    qreal refreshRate = 0;
     int rhiSampleCount = 1;
     bool rhiDeviceLost = false;
     bool rhiDoomed = false;
@@ -347,6 +354,8 @@ bool QSGRenderThread::event(QEvent *e)
         windowSize = se->size;
         dpr = se->dpr;
         scProxyData = se->scProxyData;
+        polishTime = se->polishTime;
+        refreshRate = se->refreshRate;
 
         pendingUpdate |= SyncRequest;
         if (se->syncInExpose) {
@@ -601,7 +610,9 @@ void QSGRenderThread::handleDeviceLoss()
 
 void QSGRenderThread::syncAndRender()
 {
-    const bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    const bool logFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    const bool recordFrames = QQuickWindowPrivate::get(window)->frameTimings.isEnabled();
+    const bool profileFrames = logFrames || recordFrames;
     QElapsedTimer threadTimer;
     qint64 syncTime = 0, renderTime = 0;
     if (profileFrames)
@@ -612,7 +623,7 @@ void QSGRenderThread::syncAndRender()
 
     qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "syncAndRender()");
 
-    if (profileFrames) {
+    if (logFrames) {
         const qint64 elapsedSinceLastMs = m_threadTimeBetweenRenders.restart();
         qCDebug(QSG_LOG_TIME_RENDERLOOP, "[window %p][render thread %p] syncAndRender: start, elapsed since last call: %d ms",
                 window,
@@ -812,7 +823,17 @@ void QSGRenderThread::syncAndRender()
         mutex.unlock();
     }
 
-    if (profileFrames) {
+    if (recordFrames && canRender) {
+        // The polish time came with the sync request. It is zero for frames
+        // rendered without a sync, for example for render thread animations.
+        const qint64 swapTime = threadTimer.nsecsElapsed();
+        d->frameTimings.recordFrame({ polishTime, syncTime, renderTime - syncTime,
+                                      swapTime - renderTime },
+                                    refreshRate);
+    }
+    polishTime = 0;
+
+    if (logFrames) {
         // Beware that there is no guarantee the graphics stack always
         // blocks for a full vsync in beginFrame() or endFrame(). (because
         // e.g. there is no guarantee that OpenGL blocks in swapBuffers(),
@@ -1621,9 +1642,12 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
         }
     }
 
-    const bool profileFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
-    if (profileFrames) {
+    QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
+    const bool logFrames = QSG_LOG_TIME_RENDERLOOP().isDebugEnabled();
+    const bool profileFrames = logFrames || d->frameTimings.isEnabled();
+    if (profileFrames)
         timer.start();
+    if (logFrames) {
         qCDebug(QSG_LOG_TIME_RENDERLOOP, "[window %p][gui thread] polishAndSync: start, elapsed since last call: %d ms",
                 window,
                 int(elapsedSinceLastMs));
@@ -1631,7 +1655,6 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphPolishAndSync);
     Q_TRACE(QSG_polishItems_entry);
 
-    QQuickWindowPrivate *d = QQuickWindowPrivate::get(window);
     m_inPolish = true;
     d->polishItems();
     m_inPolish = false;
@@ -1653,7 +1676,9 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
     qCDebug(QSG_LOG_RENDERLOOP, "- lock for sync");
     w->thread->mutex.lock();
     m_lockedForSync = true;
-    w->thread->postEvent(new WMSyncEvent(window, inExpose, w->forceRenderPass, scProxyData));
+    w->thread->postEvent(new WMSyncEvent(window, inExpose, w->forceRenderPass, scProxyData,
+                                         polishTime,
+                                         window->screen() ? window->screen()->refreshRate() : 0));
     w->forceRenderPass = false;
 
     qCDebug(QSG_LOG_RENDERLOOP, "- wait for sync");
@@ -1729,7 +1754,7 @@ void QSGThreadedRenderLoop::polishAndSync(Window *w, bool inExpose)
         postUpdateRequest(w);
     }
 
-    if (profileFrames) {
+    if (logFrames) {
         qCDebug(QSG_LOG_TIME_RENDERLOOP, "[window %p][gui thread] Frame prepared, polish=%d ms, lock=%d ms, blockedForSync=%d ms, animations=%d ms",
                 window,
                 int(polishTime / 1000000),
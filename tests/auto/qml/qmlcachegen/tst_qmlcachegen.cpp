@@ -13,6 +13,7 @@
 #include <QLoggingCategory>
 #include <private/qqmlcomponent_p.h>
 #include <private/qqmljscompilerstats_p.h>
+#include <private/qqmljscompilerstatsreporter_p.h>
 #include <private/qqmlscriptdata_p.h>
 #include <private/qv4compileddata_p.h>
 #include <qtranslator.h>
@@ -71,8 +72,12 @@ private slots:
     void saveableUnitPointer();
 
     void aotstatsSerialization();
+    void aotstatsFailureReasons();
     void aotstatsGeneration_data();
     void aotstatsGeneration();
+
+    void batchMode();
+    void batchModeCpp();
 };
 
 // A wrapper around QQmlComponent to ensure the temporary reference counts
@@ -961,6 +966,40 @@ void tst_qmlcachegen::aotstatsSerialization()
     QVERIFY(equal(parsedB["File3"][0], originalB["File3"][0]));
 }
 
+void tst_qmlcachegen::aotstatsFailureReasons()
+{
+    const auto createEntry = [](const QString &name, const QString &error) {
+        QQmlJS::AotStatsEntry entry;
+        entry.codegenDuration = std::chrono::microseconds(100);
+        entry.functionName = name;
+        entry.errorMessage = error;
+        entry.codegenSuccessful = error.isEmpty();
+        return entry;
+    };
+
+    QQmlJS::AotStats stats;
+    stats.addEntry("ModuleA", "File1", createEntry("f1", ""));
+    stats.addEntry("ModuleA", "File1", createEntry("f2", "err1"));
+    stats.addEntry("ModuleA", "File2", createEntry("f3", "Cannot find name foo"));
+    stats.addEntry("ModuleB", "File3", createEntry("f4", "Cannot find name bar"));
+    stats.addEntry("ModuleB", "File3",
+                   createEntry("f5", "Type QQuickItem does not have a property baz for reading"));
+    stats.addEntry("ModuleB", "File3",
+                   createEntry("f6", "Type QQuickText does not have a property baz for reading"));
+    stats.addEntry("ModuleB", "File3", createEntry("f7", "Cannot find name baz"));
+
+    // Failures differing only in the names involved are counted together.
+    const QString formatted = QQmlJS::AotStatsReporter(stats).format();
+    const QString expected =
+            u"Most frequent reasons for failed codegens:\n"
+            u"  3 (50%): Cannot find name <name>\n"
+            u"    e.g. Cannot find name bar\n"
+            u"  2 (33.33%): Type <name> does not have a property <name> for reading\n"
+            u"    e.g. Type QQuickItem does not have a property baz for reading\n"
+            u"  1 (16.67%): err1\n"_s;
+    QVERIFY2(formatted.endsWith(expected), qPrintable(formatted));
+}
+
 struct FunctionEntry
 {
     QString name;
@@ -1028,6 +1067,132 @@ void tst_qmlcachegen::aotstatsGeneration()
     }
 }
 
+// Returns the path of the written file, or an empty string if it cannot be written.
+static QString writeTempFile(
+        const QTemporaryDir &tempDir, const QString &fileName, const QByteArray &contents)
+{
+    QFile f(tempDir.path() + '/' + fileName);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate) || f.write(contents) != contents.size())
+        return QString();
+    return f.fileName();
+}
+
+void tst_qmlcachegen::batchMode()
+{
+#if defined(QTEST_CROSS_COMPILED)
+    QSKIP("Cannot call qmlcachegen on cross-compiled target.");
+#endif
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const QString qmlFile = writeTempFile(
+            tempDir, u"batch.qml"_s, "import QtQml\nQtObject { property int value: 42 }\n");
+    QVERIFY(!qmlFile.isEmpty());
+    const QString jsFile = writeTempFile(tempDir, u"batch.js"_s, "function f() { return 42; }\n");
+    QVERIFY(!jsFile.isEmpty());
+    const QString batchFile = writeTempFile(
+            tempDir, u"batch.txt"_s,
+            (qmlFile + u';' + qmlFile + u"c\n"_s + jsFile + u';' + jsFile + u"c\n"_s).toUtf8());
+    QVERIFY(!batchFile.isEmpty());
+
+    QProcess proc;
+    proc.setProcessChannelMode(QProcess::ForwardedChannels);
+    proc.setProgram(QLibraryInfo::path(QLibraryInfo::LibraryExecutablesPath)
+                    + QLatin1String("/qmlcachegen"));
+    proc.setArguments({ u"--batch"_s, batchFile });
+    proc.start();
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(proc.exitCode(), 0);
+
+    QVERIFY(QFile::exists(qmlFile + u'c'));
+    QVERIFY(QFile::exists(jsFile + u'c'));
+
+    // Input files and --batch are mutually exclusive
+    proc.setArguments({ u"--batch"_s, batchFile, qmlFile });
+    proc.start();
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitStatus(), QProcess::NormalExit);
+    QVERIFY(proc.exitCode() != 0);
+}
+
+void tst_qmlcachegen::batchModeCpp()
+{
+#if defined(QTEST_CROSS_COMPILED)
+    QSKIP("Cannot call qmlcachegen on cross-compiled target.");
+#endif
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    // A module whose singleton is not declared as such in its qmldir. Resolving the type
+    // produces an import warning in the shared importer.
+    QVERIFY(QDir(tempDir.path()).mkpath(u"imports/Broken"_s));
+    QVERIFY(!writeTempFile(tempDir, u"imports/Broken/qmldir"_s,
+                           "module Broken\nSingle 1.0 Single.qml\n").isEmpty());
+    QVERIFY(!writeTempFile(tempDir, u"imports/Broken/Single.qml"_s,
+                           "pragma Singleton\nimport QtQml\nQtObject {}\n").isEmpty());
+
+    const QByteArray source = "import QtQml\nimport Broken\n"
+                              "QtObject {\n"
+                              "    property QtObject single: Single\n"
+                              "    property int length: objectName.length\n"
+                              "}\n";
+    const QString first = writeTempFile(tempDir, u"First.qml"_s, source);
+    QVERIFY(!first.isEmpty());
+    const QString second = writeTempFile(tempDir, u"Second.qml"_s, source);
+    QVERIFY(!second.isEmpty());
+    // Does not import the broken module at all.
+    const QString third = writeTempFile(
+            tempDir, u"Third.qml"_s,
+            "import QtQml\nQtObject {\n    property int length: objectName.length\n}\n");
+    QVERIFY(!third.isEmpty());
+    const QString batchFile = writeTempFile(
+            tempDir, u"batch.txt"_s,
+            (first + u';' + first + u".cpp;/qt/qml/Batch/First.qml\n"_s
+             + second + u';' + second + u".cpp;/qt/qml/Batch/Second.qml\n"_s
+             + third + u';' + third + u".cpp;/qt/qml/Batch/Third.qml\n"_s).toUtf8());
+    QVERIFY(!batchFile.isEmpty());
+
+    QProcess proc;
+    proc.setProgram(QLibraryInfo::path(QLibraryInfo::LibraryExecutablesPath)
+                    + QLatin1String("/qmlcachegen"));
+    proc.setArguments({ u"--batch"_s, batchFile, u"-I"_s, tempDir.path() + u"/imports"_s,
+                        u"--warnings-are-errors"_s });
+    proc.start();
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitStatus(), QProcess::NormalExit);
+
+    // The warning is reported once, for the file that resolved the broken type first. The
+    // other files do not replay it.
+    const QString errors = QString::fromUtf8(proc.readAllStandardError());
+    QCOMPARE(errors.count(u"not declared as singleton in qmldir"_s), 1);
+    const auto reportsTypeWarnings = [&errors](const QString &fileName) {
+        return errors.contains(fileName + u":: Type warnings occurred"_s);
+    };
+    QVERIFY2(reportsTypeWarnings(u"First.qml"_s), qPrintable(errors));
+    QVERIFY2(!reportsTypeWarnings(u"Second.qml"_s), qPrintable(errors));
+    QVERIFY2(!reportsTypeWarnings(u"Third.qml"_s), qPrintable(errors));
+    QVERIFY(proc.exitCode() != 0);
+
+    // The file that does not import the broken module compiles cleanly on its own.
+    proc.setArguments({ third, u"-o"_s, third + u".single.cpp"_s,
+                        u"--resource-path"_s, u"/qt/qml/Batch/Third.qml"_s,
+                        u"-I"_s, tempDir.path() + u"/imports"_s, u"--warnings-are-errors"_s });
+    proc.start();
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(proc.exitCode(), 0);
+
+    // All files have been compiled to C++, including their bindings.
+    for (const QString &file : { first, second, third }) {
+        QFile cpp(file + u".cpp"_s);
+        QVERIFY2(cpp.open(QIODevice::ReadOnly), qPrintable(cpp.fileName()));
+        const QByteArray code = cpp.readAll();
+        QVERIFY(code.contains("aotBuiltFunctions"));
+        QVERIFY(!code.contains("aotBuiltFunctions[] = { { 0, 0, nullptr, nullptr } };"));
+    }
+}
+
 const QQmlScriptString &ScriptStringProps::undef() const
 {
     return m_undef;
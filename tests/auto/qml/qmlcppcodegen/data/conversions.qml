@@ -101,6 +101,11 @@ QtObject {
     property string stringType: typeof "bah"
     property string objectType: typeof null
     property string symbolType: typeof Symbol("baz") 
+    property string selfType: typeof self
+    property string primitiveType: {
+        var x = anInt ? "a" : 5
+        return typeof x
+    }
 
     property var modulos: [
         -20 % -1,
@@ -1284,6 +1284,8 @@ void tst_QmlCppCodegen::conversions()
     QCOMPARE(object->property("stringType").toString(), u"string"_s);
     QCOMPARE(object->property("objectType").toString(), u"object"_s);
     QCOMPARE(object->property("symbolType").toString(), u"symbol"_s);
+    QCOMPARE(object->property("selfType").toString(), u"object"_s);
+    QCOMPARE(object->property("primitiveType").toString(), u"string"_s);
 
     QJSManagedValue obj = engine.toManagedValue(object->property("anObject"));
     QCOMPARE(obj.property(u"a"_s).toInt(), 12);
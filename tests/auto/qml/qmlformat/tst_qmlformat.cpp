@@ -623,15 +623,21 @@ void TestQmlformat::testFilesOption_data()
 {
     QTest::addColumn<QString>("containerFile");
     QTest::addColumn<QStringList>("individualFiles");
+    QTest::addColumn<QStringList>("extraArguments");
 
     QTest::newRow("initial") << "fileListToFormat"
-            << QStringList{"valid1.qml", "invalidEntry:cannot be parsed", "valid2.qml"};
+            << QStringList{"valid1.qml", "invalidEntry:cannot be parsed", "valid2.qml"}
+            << QStringList{};
+    QTest::newRow("parallel") << "fileListToFormat"
+            << QStringList{"valid1.qml", "invalidEntry:cannot be parsed", "valid2.qml"}
+            << QStringList{"-j", "2"};
 }
 
 void TestQmlformat::testFilesOption()
 {
     QFETCH(QString, containerFile);
     QFETCH(QStringList, individualFiles);
+    QFETCH(QStringList, extraArguments);
 
     // Create a temporary directory
     QTemporaryDir tempDir;
@@ -662,7 +668,7 @@ void TestQmlformat::testFilesOption()
 
     {
         QProcess process;
-        process.start(m_qmlformatPath, QStringList{"-F", tempFilePath});
+        process.start(m_qmlformatPath, QStringList{"-F", tempFilePath} + extraArguments);
         QVERIFY(process.waitForFinished());
         QCOMPARE(process.exitStatus(), QProcess::NormalExit);
     }
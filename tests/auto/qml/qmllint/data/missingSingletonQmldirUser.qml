@@ -0,0 +1,6 @@
+import QtQml
+import Singletons
+
+QtObject {
+  Component.onCompleted: console.log(MissingQmldirSingleton)
+}
@@ -123,6 +123,11 @@ private Q_SLOTS:
 
 #if QT_CONFIG(process)
     void importRelScript();
+    void parallelLinting();
+    void parallelLintingImportWarnings_data();
+    void parallelLintingImportWarnings();
+    void invalidJobCount_data();
+    void invalidJobCount();
 #endif
 
     void replayImportWarnings();
@@ -150,6 +155,10 @@ private:
                        const QStringList &extraArgs = QStringList(), bool ignoreSettings = true,
                        bool addImportDirs = true, bool absolutePath = true,
                        const Environment &env = {});
+#if QT_CONFIG(process)
+    void lintFilesJson(const QStringList &files, const QStringList &extraArgs, QByteArray *output,
+                       int *exitCode);
+#endif
     void callQmllint(const QString &fileToLint, bool shouldSucceed, QJsonArray *warnings = nullptr,
                      QStringList importDirs = {}, QStringList qmltypesFiles = {},
                      QStringList resources = {},
@@ -1686,6 +1695,20 @@ QString TestQmllint::runQmllint(const QString &fileToLint, bool shouldSucceed,
             extraArgs, ignoreSettings, addImportDirs, absolutePath, env);
 }
 
+#if QT_CONFIG(process)
+void TestQmllint::lintFilesJson(const QStringList &files, const QStringList &extraArgs,
+                                QByteArray *output, int *exitCode)
+{
+    QProcess proc;
+    proc.start(m_qmllintPath,
+               QStringList { u"--json"_s, u"-"_s, u"-I"_s, dataDirectory() } + extraArgs + files);
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitStatus(), QProcess::NormalExit);
+    *output = proc.readAllStandardOutput();
+    *exitCode = proc.exitCode();
+}
+#endif
+
 void TestQmllint::callQmllint(const QString &fileToLint, bool shouldSucceed, QJsonArray *warnings,
                               QStringList importPaths, QStringList qmldirFiles,
                               QStringList resources, DefaultImportOption defaultImports,
@@ -2528,6 +2551,87 @@ void TestQmllint::importRelScript()
     QVERIFY(proc.readAllStandardOutput().isEmpty());
     QVERIFY(proc.readAllStandardError().isEmpty());
 }
+
+void TestQmllint::parallelLinting()
+{
+    const QStringList files = {
+        testFile(u"badScript.qml"_s),
+        testFile(u"memberNotFound.qml"_s),
+        testFile(u"Simple.qml"_s),
+        testFile(u"something.qml"_s),
+    };
+
+    QByteArray sequential;
+    int sequentialExitCode = 0;
+    lintFilesJson(files, {}, &sequential, &sequentialExitCode);
+    QVERIFY(!sequential.isEmpty());
+
+    QByteArray parallel;
+    int parallelExitCode = 0;
+    lintFilesJson(files, { u"-j"_s, u"3"_s }, &parallel, &parallelExitCode);
+    QVERIFY(!QTest::currentTestFailed());
+
+    // Same results, in the same order
+    QCOMPARE(parallel, sequential);
+    QCOMPARE(parallelExitCode, sequentialExitCode);
+}
+
+void TestQmllint::parallelLintingImportWarnings_data()
+{
+    QTest::addColumn<QString>("jobs");
+    QTest::addRow("2 jobs") << u"2"_s;
+    QTest::addRow("4 jobs") << u"4"_s;
+}
+
+void TestQmllint::parallelLintingImportWarnings()
+{
+    QFETCH(QString, jobs);
+
+    // Problems with imported types are reported only for the first file using them. With
+    // several jobs, that must still be the first file on the command line.
+    const QStringList files = {
+        testFile(u"Simple.qml"_s),
+        testFile(u"missingSingletonQmldir.qml"_s),
+        testFile(u"invalidImport.qml"_s),
+        testFile(u"missingSingletonQmldirUser.qml"_s),
+    };
+
+    QByteArray sequential;
+    int sequentialExitCode = 0;
+    lintFilesJson(files, {}, &sequential, &sequentialExitCode);
+    QCOMPARE(sequential.count("not declared as singleton in qmldir"), 1);
+    QVERIFY(sequential.contains("Failed to import FooBar"));
+
+    // Repeat, as the attribution would depend on the scheduling if it went wrong.
+    for (int i = 0; i < 5; ++i) {
+        QByteArray parallel;
+        int parallelExitCode = 0;
+        lintFilesJson(files, { u"-j"_s, jobs }, &parallel, &parallelExitCode);
+        QVERIFY(!QTest::currentTestFailed());
+        QCOMPARE(parallel, sequential);
+        QCOMPARE(parallelExitCode, sequentialExitCode);
+    }
+}
+
+void TestQmllint::invalidJobCount_data()
+{
+    QTest::addColumn<QString>("jobs");
+    QTest::addRow("zero") << u"0"_s;
+    QTest::addRow("negative") << u"-2"_s;
+    QTest::addRow("not a number") << u"many"_s;
+}
+
+void TestQmllint::invalidJobCount()
+{
+    QFETCH(QString, jobs);
+
+    QProcess proc;
+    proc.start(m_qmllintPath, { u"-j"_s, jobs, testFile(u"Simple.qml"_s) });
+    QVERIFY(proc.waitForFinished());
+    QCOMPARE(proc.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(proc.exitCode(), 1);
+    QVERIFY(proc.readAllStandardError().contains("Invalid value for --jobs"));
+}
 #endif
 
 void TestQmllint::replayImportWarnings()
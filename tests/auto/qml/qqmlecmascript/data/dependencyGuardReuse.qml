@@ -0,0 +1,7 @@
+import QtQml
+import test
+
+GuardReuse {
+    property int inserted: flag ? c * 100 + a * 10 + b : a * 10 + b
+    property int swapped: flag ? a * 10 + b : b * 10 + a
+}
@@ -82,6 +82,7 @@ private slots:
     void contextPropertiesTriggerReeval();
     void objectPropertiesTriggerReeval();
     void dependenciesWithFunctions();
+    void dependencyGuardReuse();
     void immediateProperties();
     void deferredProperties();
     void deferredPropertiesParent();
@@ -1213,6 +1214,91 @@ void tst_qqmlecmascript::dependenciesWithFunctions()
     QVERIFY(object->property("success").toBool());
 }
 
+class GuardReuseObject : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool flag MEMBER flag NOTIFY flagChanged)
+    Q_PROPERTY(int a MEMBER a NOTIFY aChanged)
+    Q_PROPERTY(int b MEMBER b NOTIFY bChanged)
+    Q_PROPERTY(int c MEMBER c NOTIFY cChanged)
+signals:
+    void flagChanged();
+    void aChanged();
+    void bChanged();
+    void cChanged();
+
+public:
+    bool flag = false;
+    int a = 1;
+    int b = 2;
+    int c = 3;
+
+    // Every guard the bindings have to newly allocate connects to the signal.
+    // Reused guards stay connected and don't show up here.
+    int connections = 0;
+
+protected:
+    void connectNotify(const QMetaMethod &signal) override
+    {
+        if (signal == QMetaMethod::fromSignal(&GuardReuseObject::flagChanged)
+                || signal == QMetaMethod::fromSignal(&GuardReuseObject::aChanged)
+                || signal == QMetaMethod::fromSignal(&GuardReuseObject::bChanged)
+                || signal == QMetaMethod::fromSignal(&GuardReuseObject::cChanged)) {
+            ++connections;
+        }
+    }
+};
+
+void tst_qqmlecmascript::dependencyGuardReuse()
+{
+    qmlRegisterType<GuardReuseObject>("test", 1, 0, "GuardReuse");
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("dependencyGuardReuse.qml"));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+    GuardReuseObject *object = qobject_cast<GuardReuseObject *>(root.data());
+    QVERIFY(object);
+
+    QCOMPARE(object->property("inserted").toInt(), 12);
+    QCOMPARE(object->property("swapped").toInt(), 21);
+    // flag, a and b for each binding
+    QCOMPARE(object->connections, 6);
+
+    // "inserted" now reads c in front of a and b. Only c needs a new guard.
+    // "swapped" reads a and b in the opposite order; one of them is
+    // reconnected.
+    object->connections = 0;
+    object->setProperty("flag", true);
+    QCOMPARE(object->property("inserted").toInt(), 312);
+    QCOMPARE(object->property("swapped").toInt(), 12);
+    QCOMPARE(object->connections, 2);
+
+    // No notification may get lost on the way.
+    object->setProperty("a", 4);
+    QCOMPARE(object->property("inserted").toInt(), 342);
+    QCOMPARE(object->property("swapped").toInt(), 42);
+    object->setProperty("b", 5);
+    QCOMPARE(object->property("inserted").toInt(), 345);
+    QCOMPARE(object->property("swapped").toInt(), 45);
+    object->setProperty("c", 6);
+    QCOMPARE(object->property("inserted").toInt(), 645);
+
+    // Dropping c again lets the guards of a and b be reused as they are.
+    object->connections = 0;
+    object->setProperty("flag", false);
+    QCOMPARE(object->property("inserted").toInt(), 45);
+    QCOMPARE(object->property("swapped").toInt(), 54);
+    QCOMPARE(object->connections, 1);
+
+    object->setProperty("a", 7);
+    QCOMPARE(object->property("inserted").toInt(), 75);
+    QCOMPARE(object->property("swapped").toInt(), 57);
+    object->setProperty("b", 8);
+    QCOMPARE(object->property("inserted").toInt(), 78);
+    QCOMPARE(object->property("swapped").toInt(), 87);
+}
+
 void tst_qqmlecmascript::immediateProperties()
 {
     QQmlEngine engine;
@@ -0,0 +1,5 @@
+import QtQuick
+
+Item {
+    property int unrelated: 42
+}
@@ -0,0 +1,5 @@
+import QtQuick
+
+Declaration {
+    onlyUsedInAnotherFile: 42
+}
@@ -783,6 +783,22 @@ void tst_qmlls_utils::findUsages_data()
             QTest::addRow("findPropertyFromOtherFile") << 42 << 13 << helloPropertyUsages;
         }
     }
+    {
+        // the only usage is in another file, which must not be skipped by the textual prefilter
+        // while the unrelated file in the same directory is
+        const auto testFileName = testFile("findUsages/usageInOtherFileOnly/Declaration.qml");
+        const auto otherFileName = testFile("findUsages/usageInOtherFileOnly/UsesDeclaration.qml");
+        const auto testFileContent = readFileContent(testFileName);
+        const auto otherFileContent = readFileContent(otherFileName);
+
+        QList<QQmlLSUtils::Location> expectedUsages;
+        expectedUsages << QQmlLSUtils::Location::from(testFileName, testFileContent, 4, 18,
+                                                      strlen("onlyUsedInAnotherFile"));
+        expectedUsages << QQmlLSUtils::Location::from(otherFileName, otherFileContent, 4, 5,
+                                                      strlen("onlyUsedInAnotherFile"));
+        const auto usages = makeUsages(testFileName, expectedUsages);
+        QTest::addRow("findPropertyOnlyUsedInOtherFile") << 4 << 18 << usages;
+    }
     {
         const auto testFileName = testFile("findUsages/propertyInNested/propertyInNested.qml");
         const auto testFileContent = readFileContent(testFileName);
@@ -76,6 +76,12 @@ private Q_SLOTS:
     void textureNodeRect_data();
     void textureNodeRect();
 
+    // Vertex transforms of the batch renderer
+    void mapPositions_data();
+    void mapPositions();
+    void translatePositions_data();
+    void translatePositions();
+
 private:
     void rhiTestData();
 
@@ -484,6 +490,122 @@ void NodesTest::textureNodeRect()
     renderContext->invalidate();
 }
 
+static void vertexLayoutTestData()
+{
+    QTest::addColumn<int>("stride");
+    QTest::addColumn<int>("count");
+
+    // Tightly packed positions are done two at a time, so test odd counts, too.
+    const int strides[] = { int(sizeof(QSGGeometry::Point2D)),
+                            int(sizeof(QSGGeometry::ColoredPoint2D)),
+                            int(sizeof(QSGGeometry::TexturedPoint2D)) };
+    for (int stride : strides) {
+        for (int count : { 0, 1, 2, 7, 64 })
+            QTest::addRow("stride %d, %d vertices", stride, count) << stride << count;
+    }
+}
+
+#ifdef QT_BUILD_INTERNAL
+static QByteArray vertexTestData(int stride, int count)
+{
+    QByteArray data(stride * count, Qt::Uninitialized);
+    for (int i = 0; i < data.size(); ++i)
+        data[i] = char(i * 7);
+    for (int i = 0; i < count; ++i) {
+        float *pos = reinterpret_cast<float *>(data.data() + i * stride);
+        pos[0] = -250.5f + i * 13.25f;
+        pos[1] = 480.0f - i * 9.75f;
+    }
+    return data;
+}
+
+static bool fuzzyCompareVertices(const QByteArray &actual, const QByteArray &expected,
+                                 int stride, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        const char *a = actual.constData() + i * stride;
+        const char *e = expected.constData() + i * stride;
+        for (int c = 0; c < 2; ++c) {
+            const float av = reinterpret_cast<const float *>(a)[c];
+            const float ev = reinterpret_cast<const float *>(e)[c];
+            if (qAbs(av - ev) > 1e-4f * qMax(1.0f, qAbs(ev))) {
+                qWarning() << "vertex" << i << "component" << c << "is" << av << "expected" << ev;
+                return false;
+            }
+        }
+        // The other attributes are left alone.
+        if (memcmp(a + 2 * sizeof(float), e + 2 * sizeof(float), stride - 2 * sizeof(float)) != 0) {
+            qWarning() << "attributes of vertex" << i << "were modified";
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+void NodesTest::mapPositions_data()
+{
+    vertexLayoutTestData();
+}
+
+void NodesTest::mapPositions()
+{
+#ifdef QT_BUILD_INTERNAL
+    QFETCH(int, stride);
+    QFETCH(int, count);
+
+    QMatrix4x4 matrix;
+    matrix.translate(31.5f, -12.25f);
+    matrix.rotate(33, 0, 0, 1);
+    matrix.scale(1.75f, 0.6f);
+    const float *m = matrix.constData();
+
+    QByteArray expected = vertexTestData(stride, count);
+    for (int i = 0; i < count; ++i) {
+        float *pos = reinterpret_cast<float *>(expected.data() + i * stride);
+        const double x = pos[0];
+        const double y = pos[1];
+        pos[0] = float(x * m[0] + y * m[4] + m[12]);
+        pos[1] = float(x * m[1] + y * m[5] + m[13]);
+    }
+
+    QByteArray actual = vertexTestData(stride, count);
+    QSGBatchRenderer::qsg_mapPositions(actual.data(), count, stride, m);
+    QVERIFY(fuzzyCompareVertices(actual, expected, stride, count));
+#else
+    QSKIP("This test relies on private APIs that are only exported in developer-builds");
+#endif
+}
+
+void NodesTest::translatePositions_data()
+{
+    vertexLayoutTestData();
+}
+
+void NodesTest::translatePositions()
+{
+#ifdef QT_BUILD_INTERNAL
+    QFETCH(int, stride);
+    QFETCH(int, count);
+
+    const float dx = 17.5f;
+    const float dy = -230.25f;
+
+    QByteArray expected = vertexTestData(stride, count);
+    for (int i = 0; i < count; ++i) {
+        float *pos = reinterpret_cast<float *>(expected.data() + i * stride);
+        pos[0] += dx;
+        pos[1] += dy;
+    }
+
+    QByteArray actual = vertexTestData(stride, count);
+    QSGBatchRenderer::qsg_translatePositions(actual.data(), count, stride, dx, dy);
+    QVERIFY(fuzzyCompareVertices(actual, expected, stride, count));
+#else
+    QSKIP("This test relies on private APIs that are only exported in developer-builds");
+#endif
+}
+
 QTEST_MAIN(NodesTest);
 
 #include "tst_nodestest.moc"
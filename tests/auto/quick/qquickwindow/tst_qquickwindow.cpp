@@ -437,6 +437,7 @@ private slots:
     void constantUpdates();
     void constantUpdatesOnWindow_data();
     void constantUpdatesOnWindow();
+    void frameTimings();
     void mouseFiltering();
     void headless();
     void destroyShowWithoutHide();
@@ -618,6 +619,34 @@ void tst_qquickwindow::constantUpdates()
     QTRY_VERIFY(afterSpy.size() > 10);
 }
 
+void tst_qquickwindow::frameTimings()
+{
+    QQuickWindow window;
+    window.resize(250, 250);
+    ConstantUpdateItem item(window.contentItem());
+    window.setTitle(QTest::currentTestFunction());
+
+    QQuickFrameTimings &timings = QQuickWindowPrivate::get(&window)->frameTimings;
+    QVERIFY(!timings.isEnabled());
+    timings.setEnabled(true);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    QTRY_VERIFY(timings.frames().size() > 10);
+    QVERIFY(timings.frames().size() <= QQuickFrameTimings::Capacity);
+    const qint64 median = timings.percentile(QQuickFrameTimings::Total, 50);
+    QVERIFY(median > 0);
+    QVERIFY(timings.percentile(QQuickFrameTimings::Total, 100) >= median);
+
+    timings.setEnabled(false);
+    window.hide();
+    timings.clear();
+    QVERIFY(timings.frames().isEmpty());
+    QCOMPARE(timings.missedFrameCount(), 0);
+    QCOMPARE(timings.percentile(QQuickFrameTimings::Total, 50), 0);
+}
+
 void tst_qquickwindow::constantUpdatesOnWindow_data()
 {
     QTest::addColumn<bool>("blockedGui");
@@ -4087,6 +4116,7 @@ void tst_qquickwindow::graphicsConfiguration()
     QVERIFY(config.isAutomaticPipelineCacheEnabled());
     QVERIFY(config.pipelineCacheSaveFile().isEmpty());
     QVERIFY(config.pipelineCacheLoadFile().isEmpty());
+    QVERIFY(!config.isShaderPrewarmingEnabled());
 
     QQuickGraphicsConfiguration config2 = config;
     config.setDebugLayer(true);
@@ -4101,8 +4131,10 @@ void tst_qquickwindow::graphicsConfiguration()
     config.setAutomaticPipelineCache(false);
     config.setPipelineCacheSaveFile(QLatin1String("save"));
     config.setPipelineCacheLoadFile(QLatin1String("load"));
+    config.setShaderPrewarming(true);
     config2 = config;
     QVERIFY(!config2.isAutomaticPipelineCacheEnabled());
+    QVERIFY(config2.isShaderPrewarmingEnabled());
     QCOMPARE(config2.pipelineCacheSaveFile(), QLatin1String("save"));
     QCOMPARE(config2.pipelineCacheLoadFile(), QLatin1String("load"));
 
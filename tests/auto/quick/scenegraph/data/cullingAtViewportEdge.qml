@@ -0,0 +1,43 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+import SceneGraphTest
+
+Rectangle {
+    width: 200
+    height: 200
+    color: "white"
+
+    // Translucent, so that they are in the alpha list and have their bounds
+    // calculated, which culling relies on.
+    UnmergedRect { x: -50; y: 20; width: 60; height: 20; color: "#80ff0000" }
+    UnmergedRect { x: 190; y: 20; width: 60; height: 20; color: "#8000ff00" }
+    UnmergedRect { x: 20; y: -50; width: 20; height: 60; color: "#800000ff" }
+    UnmergedRect { x: 60; y: 190; width: 20; height: 60; color: "#80000000" }
+
+    // Their twins, completely inside of the window
+    UnmergedRect { x: 110; y: 60; width: 20; height: 20; color: "#80ff0000" }
+    UnmergedRect { x: 140; y: 60; width: 20; height: 20; color: "#8000ff00" }
+    UnmergedRect { x: 110; y: 90; width: 20; height: 20; color: "#800000ff" }
+    UnmergedRect { x: 140; y: 90; width: 20; height: 20; color: "#80000000" }
+
+    // Completely outside of the window, so these are culled.
+    UnmergedRect { x: -100; y: 60; width: 50; height: 20; color: "#80000000" }
+    UnmergedRect { x: 250; y: 100; width: 50; height: 20; color: "#80000000" }
+
+    // Rotated, so that they are not merged. Antialiasing moves the vertices
+    // outwards in the vertex shader.
+    Rectangle {
+        x: -20.5; y: 100; width: 20; height: 20
+        rotation: 90
+        antialiasing: true
+        color: "black"
+    }
+    Rectangle {
+        x: 79.5; y: 140; width: 20; height: 20
+        rotation: 90
+        antialiasing: true
+        color: "black"
+    }
+}
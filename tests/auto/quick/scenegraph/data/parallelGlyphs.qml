@@ -0,0 +1,24 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+// Far more than 32 distinct glyphs, all of them new to the glyph cache of
+// the window, so that the distance fields are rendered in one go.
+Rectangle {
+    width: 400
+    height: 200
+    color: "white"
+
+    Column {
+        Repeater {
+            model: [ "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "abcdefghijklmnopqrstuvwxyz", "0123456789!?#%&()[]{}<>+-*/=" ]
+            Text {
+                required property string modelData
+                text: modelData
+                renderType: Text.QtRendering
+                font.pixelSize: 24
+            }
+        }
+    }
+}
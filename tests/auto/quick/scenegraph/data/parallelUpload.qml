@@ -0,0 +1,38 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+import QtQuick
+
+// Many batches of different materials, merged and unmerged, opaque and
+// translucent, so that there is a lot of batch data to upload.
+Rectangle {
+    width: 320
+    height: 320
+    color: "white"
+
+    Repeater {
+        model: 256
+        Item {
+            required property int index
+            x: (index % 16) * 20
+            y: Math.floor(index / 16) * 20
+            width: 20
+            height: 20
+            rotation: index % 3 === 0 ? 15 : 0
+
+            Rectangle {
+                anchors.fill: parent
+                anchors.margins: 2
+                color: Qt.rgba((parent.index % 7) / 7, (parent.index % 5) / 5, (parent.index % 3) / 3,
+                               parent.index % 2 ? 1 : 0.6)
+                antialiasing: parent.index % 4 === 0
+                radius: parent.index % 8 === 0 ? 4 : 0
+            }
+            Text {
+                anchors.centerIn: parent
+                text: parent.index
+                font.pixelSize: 8
+            }
+        }
+    }
+}
@@ -16,6 +16,8 @@
 #include <private/qopenglcontext_p.h>
 #endif
 
+#include <private/qquickwindow_p.h>
+#include <private/qsgbatchrenderer_p.h>
 #include <private/qsgcontext_p.h>
 #include <private/qsgrenderloop_p.h>
 #include <private/qsgrhisupport_p.h>
@@ -27,6 +29,9 @@
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformintegration.h>
 
+#include <atomic>
+#include <memory>
+
 using namespace QQuickVisualTestUtils;
 
 class PerPixelRect : public QQuickItem
@@ -74,6 +79,51 @@ private:
     QColor m_color;
 };
 
+// Uses 32-bit indices, which the renderer never merges into other batches.
+class UnmergedRect : public QQuickItem
+{
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_OBJECT
+public:
+    UnmergedRect() {
+        setFlag(ItemHasContents);
+    }
+
+    void setColor(const QColor &c) {
+        if (c == m_color)
+            return;
+        m_color = c;
+        emit colorChanged(c);
+    }
+
+    QColor color() const { return m_color; }
+
+    QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *) override
+    {
+        delete node;
+        auto *gn = new QSGGeometryNode;
+        auto *g = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 4, 6,
+                                  QSGGeometry::UnsignedIntType);
+        QSGGeometry::updateRectGeometry(g, QRectF(0, 0, width(), height()));
+        quint32 *indices = g->indexDataAsUInt();
+        const quint32 quad[] = { 0, 1, 2, 2, 1, 3 };
+        std::copy(std::begin(quad), std::end(quad), indices);
+        gn->setGeometry(g);
+        gn->setFlag(QSGNode::OwnsGeometry);
+        auto *material = new QSGFlatColorMaterial;
+        material->setColor(m_color);
+        gn->setMaterial(material);
+        gn->setFlag(QSGNode::OwnsMaterial);
+        return gn;
+    }
+
+Q_SIGNALS:
+    void colorChanged(const QColor &c);
+
+private:
+    QColor m_color;
+};
+
 class tst_SceneGraph : public QQmlDataTest
 {
     Q_OBJECT
@@ -89,6 +139,11 @@ private slots:
 
     void render_data();
     void render();
+    void cullingAtViewportEdge();
+    void parallelUpload();
+    void parallelGlyphs();
+    void prewarmedShaders_data();
+    void prewarmedShaders();
 #if QT_CONFIG(opengl)
     void hideWithOtherContext();
 #endif
@@ -116,6 +171,7 @@ tst_SceneGraph::tst_SceneGraph()
 void tst_SceneGraph::initTestCase()
 {
     qmlRegisterType<PerPixelRect>("SceneGraphTest", 1, 0, "PerPixelRect");
+    qmlRegisterType<UnmergedRect>("SceneGraphTest", 1, 0, "UnmergedRect");
 
     QQmlDataTest::initTestCase();
 
@@ -459,6 +515,209 @@ void tst_SceneGraph::render()
     }
 }
 
+// Elements of unmerged batches outside of the window are not drawn. Partly
+// visible ones, and ones drawing beyond their bounds, must still be drawn.
+void tst_SceneGraph::cullingAtViewportEdge()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping complex rendering tests due to not running with QRhi");
+
+    const auto render = [this](const QByteArray &culling, QImage *content, int *culledCount) {
+        // Read when the renderer of the window is created.
+        qputenv("QSG_RENDERER_VIEWPORT_CULLING", culling);
+        const auto cleanup = qScopeGuard([] { qunsetenv("QSG_RENDERER_VIEWPORT_CULLING"); });
+
+        QQuickView view;
+        view.setSource(testFileUrl("cullingAtViewportEdge.qml"));
+        view.setResizeMode(QQuickView::SizeViewToRootObject);
+        std::atomic<int> culled = -1;
+        connect(&view, &QQuickWindow::afterRendering, &view, [&view, &culled] {
+            auto *renderer = dynamic_cast<QSGBatchRenderer::Renderer *>(
+                    QQuickWindowPrivate::get(&view)->renderer);
+            culled = renderer ? renderer->culledElementCount() : -1;
+        }, Qt::DirectConnection);
+        view.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&view));
+        *content = view.grabWindow();
+        QVERIFY(!content->isNull());
+        *culledCount = culled;
+    };
+
+    QImage content;
+    int culledCount = 0;
+    render("1", &content, &culledCount);
+    if (QTest::currentTestFailed())
+        return;
+
+    // Only the two translucent rectangles that are completely outside.
+    QCOMPARE(culledCount, 2);
+
+    const qreal scale = content.devicePixelRatio();
+    if (!qFuzzyIsNull(qreal(qFloor(scale)) - scale))
+        QSKIP("Pixel positions do not map exactly with non-integer scaling factors");
+
+    const auto pixel = [&](int x, int y) {
+        return content.pixelColor(qRound(x * scale), qRound(y * scale)).rgb();
+    };
+    const auto lastPixel = [&](int x, int y) {
+        return content.pixelColor(x < 0 ? content.width() - 1 : qRound(x * scale),
+                                  y < 0 ? content.height() - 1 : qRound(y * scale)).rgb();
+    };
+
+    // Rectangles reaching out of each of the edges draw the same as their
+    // twins inside of the window.
+    QVERIFY(pixel(120, 70) != QColor(Qt::white).rgb());
+    QCOMPARE(pixel(0, 30), pixel(120, 70));
+    QCOMPARE(lastPixel(-1, 30), pixel(150, 70));
+    QCOMPARE(pixel(30, 0), pixel(120, 100));
+    QCOMPARE(lastPixel(70, -1), pixel(150, 100));
+    QCOMPARE(pixel(5, 70), QColor(Qt::white).rgb());
+
+    // Antialiased rectangles ending half a pixel before the left edge draw
+    // the same as their twins ending half a pixel before x = 100.
+    for (int y = 100; y < 120; y += 5)
+        QCOMPARE(pixel(0, y), pixel(100, y + 40));
+
+    // Culling can be turned off, which must not change the result.
+    QImage unculled;
+    render("0", &unculled, &culledCount);
+    if (QTest::currentTestFailed())
+        return;
+    QCOMPARE(culledCount, 0);
+    QString errorMessage;
+    QVERIFY2(compareImages(unculled, content, &errorMessage), qPrintable(errorMessage));
+}
+
+// Filling the batch data on several threads must render the same as filling
+// it on the render thread.
+void tst_SceneGraph::parallelUpload()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping complex rendering tests due to not running with QRhi");
+
+    const auto render = [this](const QByteArray &uploadThreads, QImage *content) {
+        // Read when the renderer of the window is created.
+        qputenv("QSG_RENDERER_UPLOAD_THREADS", uploadThreads);
+        const auto cleanup = qScopeGuard([] { qunsetenv("QSG_RENDERER_UPLOAD_THREADS"); });
+
+        QQuickView view;
+        view.setSource(testFileUrl("parallelUpload.qml"));
+        view.setResizeMode(QQuickView::SizeViewToRootObject);
+        view.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&view));
+        *content = view.grabWindow();
+        QVERIFY(!content->isNull());
+    };
+
+    QImage sequential;
+    render("1", &sequential);
+    if (QTest::currentTestFailed())
+        return;
+
+    for (const QByteArray &uploadThreads : { QByteArray("2"), QByteArray("4") }) {
+        QImage parallel;
+        render(uploadThreads, &parallel);
+        if (QTest::currentTestFailed())
+            return;
+
+        QString errorMessage;
+        const bool equal = compareImages(parallel, sequential, &errorMessage);
+        QVERIFY2(equal, qPrintable(QString::fromLatin1("%1 upload threads: %2")
+                                           .arg(QString::fromLatin1(uploadThreads), errorMessage)));
+    }
+}
+
+// Rendering many new distance field glyphs on several threads must give the
+// same glyphs as rendering them on the render thread only.
+void tst_SceneGraph::parallelGlyphs()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping complex rendering tests due to not running with QRhi");
+
+    const auto render = [this](int maxThreadCount, QImage *content) {
+        // Every window has its own render context, and so its own glyph
+        // cache, so all glyphs are new. No helpers are started when the
+        // pool's limit is 0.
+        QThreadPool *pool = QThreadPool::globalInstance();
+        const int oldMaxThreadCount = pool->maxThreadCount();
+        pool->setMaxThreadCount(maxThreadCount);
+        const auto cleanup = qScopeGuard([&] { pool->setMaxThreadCount(oldMaxThreadCount); });
+
+        QQuickView view;
+        view.setSource(testFileUrl("parallelGlyphs.qml"));
+        view.setResizeMode(QQuickView::SizeViewToRootObject);
+        view.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&view));
+        *content = view.grabWindow();
+        QVERIFY(!content->isNull());
+    };
+
+    QImage sequential;
+    render(0, &sequential);
+    if (QTest::currentTestFailed())
+        return;
+
+    QImage parallel;
+    render(qMax(4, QThread::idealThreadCount()), &parallel);
+    if (QTest::currentTestFailed())
+        return;
+
+    QString errorMessage;
+    QVERIFY2(compareImages(parallel, sequential, &errorMessage), qPrintable(errorMessage));
+}
+
+// With shader prewarming enabled, the shaders of the built-in materials are
+// prepared when the renderer is created, and taken over the first time such a
+// material is rendered.
+void tst_SceneGraph::prewarmedShaders_data()
+{
+    QTest::addColumn<bool>("enabled");
+
+    QTest::newRow("enabled") << true;
+    QTest::newRow("disabled") << false;
+}
+
+void tst_SceneGraph::prewarmedShaders()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping complex rendering tests due to not running with QRhi");
+
+    QFETCH(bool, enabled);
+
+    QQuickGraphicsConfiguration config;
+    config.setShaderPrewarming(enabled);
+
+    QQuickWindow window;
+    window.setGraphicsConfiguration(config);
+    window.resize(100, 100);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(!window.grabWindow().isNull());
+
+    const auto renderer = [&window] {
+        return dynamic_cast<QSGBatchRenderer::Renderer *>(QQuickWindowPrivate::get(&window)->renderer);
+    };
+    QVERIFY(renderer());
+    if (enabled)
+        QTRY_VERIFY(renderer()->isShaderPrewarmingFinished());
+    else
+        QVERIFY(!renderer()->isShaderPrewarmingFinished());
+    QCOMPARE(renderer()->prewarmedShadersTaken(), 0);
+
+    // Rectangles without antialiasing use QSGVertexColorMaterial.
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick\nRectangle { width: 50; height: 50; color: \"red\" }", QUrl());
+    std::unique_ptr<QQuickItem> rectangle(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY(rectangle);
+    rectangle->setParentItem(window.contentItem());
+
+    const QImage content = window.grabWindow();
+    QVERIFY(!content.isNull());
+    QCOMPARE(content.pixelColor(10, 10).rgb(), QColor(Qt::red).rgb());
+    QCOMPARE(renderer()->prewarmedShadersTaken(), enabled ? 1 : 0);
+}
+
 #if QT_CONFIG(opengl)
 // Testcase for QTBUG-34898. We make another context current on another surface
 // in the GUI thread and hide the QQuickWindow while the other context is
@@ -26,6 +26,8 @@ private slots:
     void objectproperty();
     void basicproperty_data();
     void basicproperty();
+    void diamond_data();
+    void diamond();
     void creation_data();
     void creation();
 
@@ -126,6 +128,45 @@ void tst_binding::basicproperty()
     }
 }
 
+void tst_binding::diamond_data()
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<QString>("binding");
+    QTest::addColumn<int>("result1");
+    QTest::addColumn<int>("result2");
+
+    QTest::newRow("diamond") << SRCDIR "/data/diamond.txt" << "c1" << 4 << 7;
+    QTest::newRow("diamond (chained)") << SRCDIR "/data/diamondchain.txt" << "c3" << 40 << 67;
+}
+
+// Properties declared in QML only notify when their value actually changes, so the value has to
+// alternate for the whole diamond to be re-evaluated on every change.
+void tst_binding::diamond()
+{
+    QFETCH(QString, file);
+    QFETCH(QString, binding);
+    QFETCH(int, result1);
+    QFETCH(int, result2);
+
+    COMPONENT(file, binding);
+
+    MyQmlObject *object = qobject_cast<MyQmlObject *>(c.create());
+    QVERIFY(object != 0);
+    object->setValue(1);
+    QCOMPARE(object->result(), result1);
+    object->setValue(2);
+    QCOMPARE(object->result(), result2);
+
+    QBENCHMARK {
+        object->setValue(1);
+        object->setValue(2);
+    }
+
+    QCOMPARE(object->result(), result2);
+    object->setValue(1);
+    QCOMPARE(object->result(), result1);
+}
+
 void tst_binding::creation_data()
 {
     QTest::addColumn<QString>("file");
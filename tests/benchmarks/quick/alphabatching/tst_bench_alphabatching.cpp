@@ -0,0 +1,129 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QSignalSpy>
+#include <QtCore/QElapsedTimer>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/QQuickWindow>
+
+#include <algorithm>
+#include <memory>
+
+// Measures how the batch renderer scales with the number of translucent
+// elements of alternating materials, which is the worst case for the overlap
+// checks done when merging alpha batches. The Null backend is used, so that
+// the time is spent in the scene graph rather than in a graphics driver.
+// Only the scene graph renderer is timed, from beforeRendering() to
+// afterRendering(), which covers building the batches and recording the draw
+// calls, but not polishing, synchronizing or waiting for the swap.
+
+class tst_AlphaBatching : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_AlphaBatching();
+
+private slots:
+    void initTestCase();
+
+    void prepare_data();
+    void prepare();
+};
+
+tst_AlphaBatching::tst_AlphaBatching()
+{
+}
+
+void tst_AlphaBatching::initTestCase()
+{
+    qputenv("QSG_RENDER_LOOP", "basic");
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Null);
+}
+
+void tst_AlphaBatching::prepare_data()
+{
+    QTest::addColumn<int>("cellCount");
+
+    QTest::newRow("250") << 250;
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("4000") << 4000;
+}
+
+void tst_AlphaBatching::prepare()
+{
+    QFETCH(int, cellCount);
+
+    // A grid of translucent cells, each with a text on top, like a table of prices.
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(R"(
+        import QtQuick
+        Window {
+            id: root
+            width: 800
+            height: 600
+            property int cellCount
+            property bool toggle
+            Repeater {
+                model: root.cellCount
+                Rectangle {
+                    required property int index
+                    x: (index % 40) * 20
+                    y: Math.floor(index / 40) * 6
+                    width: 24
+                    height: 10
+                    color: "#80ff8000"
+                    visible: index !== 0 || root.toggle
+                    Text {
+                        text: "12.34"
+                        font.pixelSize: 6
+                        color: "#c0000000"
+                    }
+                }
+            }
+        }
+    )", QUrl());
+    std::unique_ptr<QObject> object(component.createWithInitialProperties(
+            { { "cellCount", cellCount } }));
+    QVERIFY2(object, qPrintable(component.errorString()));
+    auto *window = qobject_cast<QQuickWindow *>(object.get());
+    QVERIFY(window);
+
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    // The basic render loop renders on the GUI thread, so direct connections
+    // are enough to time the renderer.
+    QElapsedTimer renderTimer;
+    QList<qint64> renderTimes;
+    connect(window, &QQuickWindow::beforeRendering, window,
+            [&] { renderTimer.start(); }, Qt::DirectConnection);
+    connect(window, &QQuickWindow::afterRendering, window,
+            [&] { renderTimes.append(renderTimer.nsecsElapsed()); }, Qt::DirectConnection);
+
+    QSignalSpy frameSwapped(window, &QQuickWindow::frameSwapped);
+    bool toggle = false;
+    const int frameCount = 50;
+    for (int i = 0; i < frameCount; ++i) {
+        // Adding and removing a node invalidates the batches, so each frame
+        // goes through building the render lists and the alpha batches.
+        toggle = !toggle;
+        window->setProperty("toggle", toggle);
+        frameSwapped.clear();
+        QVERIFY(frameSwapped.wait());
+    }
+    QCOMPARE_GE(renderTimes.size(), frameCount);
+
+    // The median is not skewed by the first frame, which creates all the
+    // resources, nor by the occasional scheduling hiccup.
+    auto median = renderTimes.begin() + renderTimes.size() / 2;
+    std::nth_element(renderTimes.begin(), median, renderTimes.end());
+    QTest::setBenchmarkResult(*median, QTest::WalltimeNanoseconds);
+}
+
+QTEST_MAIN(tst_AlphaBatching)
+#include "tst_bench_alphabatching.moc"
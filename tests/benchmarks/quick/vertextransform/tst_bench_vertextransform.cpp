@@ -0,0 +1,107 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtest.h>
+#include <QtGui/QMatrix4x4>
+#include <QtQuick/qsggeometry.h>
+#include <QtQuick/private/qsgbatchrenderer_p.h>
+
+// Measures transforming the vertex positions of merged batches on the CPU,
+// comparing the batch renderer's functions with a plain scalar loop.
+
+class tst_VertexTransform : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void mapPositions_data();
+    void mapPositions();
+    void translatePositions_data();
+    void translatePositions();
+};
+
+static void testData()
+{
+    QTest::addColumn<int>("stride");
+    QTest::addColumn<bool>("scalar");
+
+    const struct {
+        const char *name;
+        int stride;
+    } layouts[] = {
+        { "Point2D", int(sizeof(QSGGeometry::Point2D)) },
+        { "ColoredPoint2D", int(sizeof(QSGGeometry::ColoredPoint2D)) },
+        { "TexturedPoint2D", int(sizeof(QSGGeometry::TexturedPoint2D)) },
+    };
+    for (const auto &layout : layouts) {
+        QTest::addRow("%s, scalar", layout.name) << layout.stride << true;
+        QTest::addRow("%s", layout.name) << layout.stride << false;
+    }
+}
+
+// Enough vertices for a batch of a few hundred glyphs.
+static const int vertexCount = 4096;
+
+void tst_VertexTransform::mapPositions_data()
+{
+    testData();
+}
+
+void tst_VertexTransform::mapPositions()
+{
+    QFETCH(int, stride);
+    QFETCH(bool, scalar);
+
+    QByteArray vertices(vertexCount * stride, 0);
+    QMatrix4x4 matrix;
+    matrix.rotate(1, 0, 0, 1);
+    matrix.scale(1.0001f);
+    const float *m = matrix.constData();
+
+    if (scalar) {
+        QBENCHMARK {
+            char *vdata = vertices.data();
+            for (int i = 0; i < vertexCount; ++i) {
+                reinterpret_cast<QSGBatchRenderer::Pt *>(vdata)->map(matrix);
+                vdata += stride;
+            }
+        }
+    } else {
+        QBENCHMARK {
+            QSGBatchRenderer::qsg_mapPositions(vertices.data(), vertexCount, stride, m);
+        }
+    }
+}
+
+void tst_VertexTransform::translatePositions_data()
+{
+    testData();
+}
+
+void tst_VertexTransform::translatePositions()
+{
+    QFETCH(int, stride);
+    QFETCH(bool, scalar);
+
+    QByteArray vertices(vertexCount * stride, 0);
+
+    if (scalar) {
+        QBENCHMARK {
+            char *vdata = vertices.data();
+            for (int i = 0; i < vertexCount; ++i) {
+                QSGBatchRenderer::Pt *p = reinterpret_cast<QSGBatchRenderer::Pt *>(vdata);
+                p->x += 0.5f;
+                p->y += 0.25f;
+                vdata += stride;
+            }
+        }
+    } else {
+        QBENCHMARK {
+            QSGBatchRenderer::qsg_translatePositions(vertices.data(), vertexCount, stride,
+                                                     0.5f, 0.25f);
+        }
+    }
+}
+
+QTEST_MAIN(tst_VertexTransform)
+#include "tst_bench_vertextransform.moc"
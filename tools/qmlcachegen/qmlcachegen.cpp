@@ -24,6 +24,7 @@
 #include <private/qresourcerelocater_p.h>
 
 #include <algorithm>
+#include <optional>
 
 using namespace Qt::Literals::StringLiterals;
 
@@ -56,6 +57,172 @@ static bool argumentsFromCommandLineAndFile(QStringList& allArguments, const QSt
     return true;
 }
 
+struct CompileSettings
+{
+    QStringList qmldirFiles;
+    QString moduleId;
+    bool onlyBytecode = false;
+    bool verbose = false;
+    bool warningsAreErrors = false;
+    bool validateBasicBlocks = false;
+    bool dumpAotStats = false;
+};
+
+// The importer reports problems with imported types only once, when the types are first
+// resolved. As it is shared between the files of a batch, such a warning is reported for, and
+// with --warnings-are-errors fails, only the file that caused the type to be resolved.
+static int compileFile(
+        const QString &inputFile, const QString &outputFileName, QString inputResourcePath,
+        const CompileSettings &settings, const QQmlJSResourceFileMapper &fileMapper,
+        QQmlJSImporter *importer)
+{
+    const bool generateCpp = outputFileName.endsWith(".cpp"_L1);
+    QString inputFileUrl = inputFile;
+
+    QQmlJSSaveFunction saveFunction;
+
+    // If the user didn't specify the resource path corresponding to the file on disk being
+    // compiled, try to determine it from the resource file, if one was supplied.
+    if (inputResourcePath.isEmpty()) {
+        const QStringList resourcePaths = fileMapper.resourcePaths(
+                    QQmlJSResourceFileMapper::localFileFilter(inputFile));
+        if (generateCpp && resourcePaths.isEmpty()) {
+            fprintf(stderr, "No resource path for file: %s\n", qPrintable(inputFile));
+            return EXIT_FAILURE;
+        }
+
+        if (resourcePaths.size() == 1) {
+            inputResourcePath = resourcePaths.first();
+        } else if (generateCpp) {
+            fprintf(stderr, "Multiple resource paths for file %s. "
+                            "Use the --resource-path option to disambiguate:\n",
+                    qPrintable(inputFile));
+            for (const QString &resourcePath: resourcePaths)
+                fprintf(stderr, "\t%s\n", qPrintable(resourcePath));
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (generateCpp) {
+        inputFileUrl = "qrc://"_L1 + inputResourcePath;
+        saveFunction = [inputResourcePath, outputFileName](
+                               const QV4::CompiledData::SaveableUnitPointer &unit,
+                               const QQmlJSAotFunctionMap &aotFunctions,
+                               QString *errorString) {
+            return qSaveQmlJSUnitAsCpp(inputResourcePath, outputFileName, unit, aotFunctions, errorString);
+        };
+
+    } else {
+        saveFunction = [outputFileName](const QV4::CompiledData::SaveableUnitPointer &unit,
+                                        const QQmlJSAotFunctionMap &aotFunctions,
+                                        QString *errorString) {
+            Q_UNUSED(aotFunctions);
+            return unit.saveToDisk<char>(
+                    [&outputFileName, errorString](const char *data, quint32 size) {
+                        return QV4::CompiledData::SaveableUnitPointer::writeDataToFile(
+                                outputFileName, data, size, errorString);
+            });
+        };
+    }
+
+    if (inputFile.endsWith(".qml"_L1)) {
+        QQmlJSCompileError error;
+        if (!generateCpp || inputResourcePath.isEmpty() || settings.onlyBytecode) {
+            if (!qCompileQmlFile(inputFile, saveFunction, nullptr, &error,
+                                 /* storeSourceLocation */ false)) {
+                error.augment("Error compiling qml file: "_L1).print();
+                return EXIT_FAILURE;
+            }
+        } else {
+            QQmlJSLogger logger;
+
+            // Always trigger the qFatal() on "pragma Strict" violations.
+            logger.setCategoryLevel(qmlCompiler, QtWarningMsg);
+            logger.setCategoryIgnored(qmlCompiler, false);
+            logger.setCategoryFatal(qmlCompiler, true);
+
+            if (!settings.verbose && !settings.warningsAreErrors)
+                logger.setSilent(true);
+
+            QQmlJSAotCompiler cppCodeGen(
+                    importer, u':' + inputResourcePath, settings.qmldirFiles, &logger);
+
+            if (settings.dumpAotStats) {
+                QQmlJS::QQmlJSAotCompilerStats::clear();
+                QQmlJS::QQmlJSAotCompilerStats::setRecordAotStats(true);
+                QQmlJS::QQmlJSAotCompilerStats::setModuleId(settings.moduleId);
+            }
+
+            if (settings.validateBasicBlocks)
+                cppCodeGen.m_flags.setFlag(QQmlJSAotCompiler::ValidateBasicBlocks);
+
+            if (!qCompileQmlFile(inputFile, saveFunction, &cppCodeGen, &error,
+                                 /* storeSourceLocation */ true)) {
+                error.augment("Error compiling qml file: "_L1).print();
+                return EXIT_FAILURE;
+            }
+
+            QList<QQmlJS::DiagnosticMessage> warnings = importer->takeGlobalWarnings();
+
+            if (!warnings.isEmpty()) {
+                logger.log("Type warnings occurred while compiling file:"_L1,
+                           qmlImport, QQmlJS::SourceLocation());
+                logger.processMessages(warnings, qmlImport);
+                if (settings.warningsAreErrors)
+                    return EXIT_FAILURE;
+            }
+
+            if (settings.dumpAotStats)
+                QQmlJS::QQmlJSAotCompilerStats::instance()->saveToDisk(outputFileName + u".aotstats"_s);
+        }
+    } else if (inputFile.endsWith(".js"_L1) || inputFile.endsWith(".mjs"_L1)) {
+        QQmlJSCompileError error;
+        if (!qCompileJSFile(inputFile, inputFileUrl, saveFunction, &error)) {
+            error.augment("Error compiling js file: "_L1).print();
+            return EXIT_FAILURE;
+        }
+    } else {
+        fprintf(stderr, "Ignoring %s input file as it is not QML source code - maybe remove from QML_FILES?\n", qPrintable(inputFile));
+        if (settings.warningsAreErrors)
+            return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+struct BatchEntry
+{
+    QString inputFile;
+    QString outputFile;
+    QString resourcePath;
+};
+
+static std::optional<QList<BatchEntry>> readBatchFile(const QString &batchFile)
+{
+    QFile f(batchFile);
+    if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        fprintf(stderr, "Cannot open batch file %s\n", qPrintable(batchFile));
+        return std::nullopt;
+    }
+
+    QList<BatchEntry> entries;
+    while (!f.atEnd()) {
+        const QString line = QString::fromUtf8(f.readLine().trimmed());
+        if (line.isEmpty())
+            continue;
+
+        const QStringList fields = line.split(u';');
+        if (fields.size() < 2 || fields.size() > 3 || fields[0].isEmpty() || fields[1].isEmpty()) {
+            fprintf(stderr, "Invalid line in batch file %s: %s\n",
+                    qPrintable(batchFile), qPrintable(line));
+            return std::nullopt;
+        }
+
+        entries.append({ fields[0], fields[1], fields.size() == 3 ? fields[2] : QString() });
+    }
+    return entries;
+}
+
 int main(int argc, char **argv)
 {
     // Produce reliably the same output for the same input by disabling QHash's random seeding.
@@ -106,6 +273,9 @@ int main(int argc, char **argv)
     QCommandLineOption moduleIdOption("module-id"_L1, QCoreApplication::translate("main", "Identifies the module of the qml file being compiled for aot stats"), QCoreApplication::translate("main", "id"));
     parser.addOption(moduleIdOption);
 
+    QCommandLineOption batchOption("batch"_L1, QCoreApplication::translate("main", "Compile all files listed in the given file, one per line, as \"input;output[;resource-path]\". The imports are resolved only once for all of them."), QCoreApplication::translate("main", "batch file"));
+    parser.addOption(batchOption);
+
     QCommandLineOption outputFileOption("o"_L1, QCoreApplication::translate("main", "Output file name"), QCoreApplication::translate("main", "file name"));
     parser.addOption(outputFileOption);
 
@@ -161,8 +331,16 @@ int main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
+    const bool batch = parser.isSet(batchOption);
     const QStringList sources = parser.positionalArguments();
-    if (sources.isEmpty()){
+    if (batch) {
+        if (!sources.isEmpty() || parser.isSet(outputFileOption)
+                || parser.isSet(resourcePathOption) || parser.isSet(filterResourceFileOption)) {
+            fprintf(stderr, "--batch cannot be combined with input files, -o, --resource-path or "
+                            "--filter-resource-file\n");
+            return EXIT_FAILURE;
+        }
+    } else if (sources.isEmpty()){
         parser.showHelp();
     } else if (sources.size() > 1 && (target != GenerateLoader && target != GenerateLoaderStandAlone)) {
         fprintf(stderr, "%s\n", qPrintable("Too many input files specified: '"_L1 + sources.join("' '"_L1) + u'\''));
@@ -198,133 +376,51 @@ int main(int argc, char **argv)
         }
         return EXIT_SUCCESS;
     }
-    QString inputFileUrl = inputFile;
-
-    QQmlJSSaveFunction saveFunction;
-    QQmlJSResourceFileMapper fileMapper(parser.values(resourceOption));
-    QString inputResourcePath = parser.value(resourcePathOption);
-
-    // If the user didn't specify the resource path corresponding to the file on disk being
-    // compiled, try to determine it from the resource file, if one was supplied.
-    if (inputResourcePath.isEmpty()) {
-        const QStringList resourcePaths = fileMapper.resourcePaths(
-                    QQmlJSResourceFileMapper::localFileFilter(inputFile));
-        if (target == GenerateCpp && resourcePaths.isEmpty()) {
-            fprintf(stderr, "No resource path for file: %s\n", qPrintable(inputFile));
-            return EXIT_FAILURE;
-        }
-
-        if (resourcePaths.size() == 1) {
-            inputResourcePath = resourcePaths.first();
-        } else if (target == GenerateCpp) {
-            fprintf(stderr, "Multiple resource paths for file %s. "
-                            "Use the --%s option to disambiguate:\n",
-                    qPrintable(inputFile),
-                    qPrintable(resourcePathOption.names().first()));
-            for (const QString &resourcePath: resourcePaths)
-                fprintf(stderr, "\t%s\n", qPrintable(resourcePath));
-            return EXIT_FAILURE;
-        }
-    }
-
-    if (target == GenerateCpp) {
-        inputFileUrl = "qrc://"_L1 + inputResourcePath;
-        saveFunction = [inputResourcePath, outputFileName](
-                               const QV4::CompiledData::SaveableUnitPointer &unit,
-                               const QQmlJSAotFunctionMap &aotFunctions,
-                               QString *errorString) {
-            return qSaveQmlJSUnitAsCpp(inputResourcePath, outputFileName, unit, aotFunctions, errorString);
-        };
-
-    } else {
-        saveFunction = [outputFileName](const QV4::CompiledData::SaveableUnitPointer &unit,
-                                        const QQmlJSAotFunctionMap &aotFunctions,
-                                        QString *errorString) {
-            Q_UNUSED(aotFunctions);
-            return unit.saveToDisk<char>(
-                    [&outputFileName, errorString](const char *data, quint32 size) {
-                        return QV4::CompiledData::SaveableUnitPointer::writeDataToFile(
-                                outputFileName, data, size, errorString);
-            });
-        };
-    }
 
-    if (inputFile.endsWith(".qml"_L1)) {
-        QQmlJSCompileError error;
-        if (target != GenerateCpp || inputResourcePath.isEmpty() || parser.isSet(onlyBytecode)) {
-            if (!qCompileQmlFile(inputFile, saveFunction, nullptr, &error,
-                                 /* storeSourceLocation */ false)) {
-                error.augment("Error compiling qml file: "_L1).print();
-                return EXIT_FAILURE;
-            }
-        } else {
-            QStringList importPaths;
+    CompileSettings settings;
+    settings.qmldirFiles = QQmlJSUtils::cleanPaths(parser.values(importsOption));
+    settings.moduleId = parser.value(moduleIdOption);
+    settings.onlyBytecode = parser.isSet(onlyBytecode);
+    settings.verbose = parser.isSet(verboseOption);
+    settings.warningsAreErrors = parser.isSet(warningsAreErrorsOption);
+    settings.validateBasicBlocks = parser.isSet(validateBasicBlocksOption);
+    settings.dumpAotStats = parser.isSet(dumpAotStatsOption);
 
-            if (parser.isSet(resourceOption)) {
-                importPaths.append("qt-project.org/imports"_L1);
-                importPaths.append("qt/qml"_L1);
-            };
+    QStringList importPaths;
 
-            if (parser.isSet(importPathOption))
-                importPaths.append(parser.values(importPathOption));
+    const bool hasResources = parser.isSet(resourceOption);
+    if (hasResources) {
+        importPaths.append("qt-project.org/imports"_L1);
+        importPaths.append("qt/qml"_L1);
+    };
 
-            if (!parser.isSet(bareOption))
-                importPaths.append(QLibraryInfo::path(QLibraryInfo::QmlImportsPath));
+    if (parser.isSet(importPathOption))
+        importPaths.append(parser.values(importPathOption));
 
-            QQmlJSImporter importer(
-                        importPaths, parser.isSet(resourceOption) ? &fileMapper : nullptr);
-            QQmlJSLogger logger;
-
-            // Always trigger the qFatal() on "pragma Strict" violations.
-            logger.setCategoryLevel(qmlCompiler, QtWarningMsg);
-            logger.setCategoryIgnored(qmlCompiler, false);
-            logger.setCategoryFatal(qmlCompiler, true);
-
-            if (!parser.isSet(verboseOption) && !parser.isSet(warningsAreErrorsOption))
-                logger.setSilent(true);
-
-            QQmlJSAotCompiler cppCodeGen(
-                    &importer, u':' + inputResourcePath,
-                    QQmlJSUtils::cleanPaths(parser.values(importsOption)), &logger);
-
-            if (parser.isSet(dumpAotStatsOption)) {
-                QQmlJS::QQmlJSAotCompilerStats::setRecordAotStats(true);
-                QQmlJS::QQmlJSAotCompilerStats::setModuleId(parser.value(moduleIdOption));
-            }
+    if (!parser.isSet(bareOption))
+        importPaths.append(QLibraryInfo::path(QLibraryInfo::QmlImportsPath));
 
-            if (parser.isSet(validateBasicBlocksOption))
-                cppCodeGen.m_flags.setFlag(QQmlJSAotCompiler::ValidateBasicBlocks);
+    QQmlJSResourceFileMapper fileMapper(parser.values(resourceOption));
 
-            if (!qCompileQmlFile(inputFile, saveFunction, &cppCodeGen, &error,
-                                 /* storeSourceLocation */ true)) {
-                error.augment("Error compiling qml file: "_L1).print();
-                return EXIT_FAILURE;
-            }
+    // The importer caches all the modules it has seen. In batch mode, the imports are
+    // resolved only once for all files compiled by this process.
+    QQmlJSImporter importer(importPaths, hasResources ? &fileMapper : nullptr);
 
-            QList<QQmlJS::DiagnosticMessage> warnings = importer.takeGlobalWarnings();
+    if (batch) {
+        const auto entries = readBatchFile(parser.value(batchOption));
+        if (!entries)
+            return EXIT_FAILURE;
 
-            if (!warnings.isEmpty()) {
-                logger.log("Type warnings occurred while compiling file:"_L1,
-                           qmlImport, QQmlJS::SourceLocation());
-                logger.processMessages(warnings, qmlImport);
-                if (parser.isSet(warningsAreErrorsOption))
-                    return EXIT_FAILURE;
+        int result = EXIT_SUCCESS;
+        for (const BatchEntry &entry : *entries) {
+            if (compileFile(entry.inputFile, entry.outputFile, entry.resourcePath, settings,
+                            fileMapper, &importer) != EXIT_SUCCESS) {
+                result = EXIT_FAILURE;
             }
-
-            if (parser.isSet(dumpAotStatsOption))
-                QQmlJS::QQmlJSAotCompilerStats::instance()->saveToDisk(outputFileName + u".aotstats"_s);
-        }
-    } else if (inputFile.endsWith(".js"_L1) || inputFile.endsWith(".mjs"_L1)) {
-        QQmlJSCompileError error;
-        if (!qCompileJSFile(inputFile, inputFileUrl, saveFunction, &error)) {
-            error.augment("Error compiling js file: "_L1).print();
-            return EXIT_FAILURE;
         }
-    } else {
-        fprintf(stderr, "Ignoring %s input file as it is not QML source code - maybe remove from QML_FILES?\n", qPrintable(inputFile));
-        if (parser.isSet(warningsAreErrorsOption))
-            return EXIT_FAILURE;
+        return result;
     }
 
-    return EXIT_SUCCESS;
+    return compileFile(inputFile, outputFileName, parser.value(resourcePathOption), settings,
+                       fileMapper, &importer);
 }
@@ -4,6 +4,7 @@
 #include <QCoreApplication>
 #include <QFile>
 #include <QTextStream>
+#include <QThread>
 
 #include <QtQml/private/qqmljslexer_p.h>
 #include <QtQml/private/qqmljsparser_p.h>
@@ -23,6 +24,11 @@
 #include <QtQmlFormat/private/qqmlformatsettings_p.h>
 #include <QtQmlFormat/private/qqmlformatoptions_p.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
 using namespace QQmlJS::Dom;
 
 static void logParsingErrors(const DomItem &fileItem, const QString &filename)
@@ -172,6 +178,12 @@ QQmlFormatOptions buildCommandLineOptions(const QCoreApplication &app)
 
     parser.addOption(QCommandLineOption(QStringList() << "functions-spacing", QStringLiteral("Ensure spaces between functions (only works with normalize option).")));
 
+    parser.addOption(QCommandLineOption(
+            { "j", "jobs" },
+            QStringLiteral("Format up to \"count\" files in parallel (only works with inplace "
+                           "formatting). 0 uses one job per CPU core."),
+            "count", "1"));
+
     parser.addPositionalArgument("filenames", "files to be processed by qmlformat");
 
     parser.process(app);
@@ -191,6 +203,14 @@ QQmlFormatOptions buildCommandLineOptions(const QCoreApplication &app)
         return options;
     }
 
+    bool jobsOkay = false;
+    const int jobs = parser.value("jobs").toInt(&jobsOkay);
+    if (!jobsOkay || jobs < 0) {
+        QQmlFormatOptions options;
+        options.addError("Error: Invalid value passed to -j");
+        return options;
+    }
+
     QStringList files;
     if (!parser.value("files").isEmpty()) {
         QFile file(parser.value("files"));
@@ -211,6 +231,7 @@ QQmlFormatOptions buildCommandLineOptions(const QCoreApplication &app)
     options.setIsVerbose(parser.isSet("verbose"));
     options.setIsInplace(parser.isSet("inplace"));
     options.setForceEnabled(parser.isSet("force"));
+    options.setJobs(jobs == 0 ? QThread::idealThreadCount() : jobs);
     options.setTabsEnabled(parser.isSet("tabs"));
     options.setIgnoreSettingsEnabled(parser.isSet("ignore-settings"));
     options.setNormalizeEnabled(parser.isSet("normalize"));
@@ -270,23 +291,60 @@ int main(int argc, char *argv[])
         return perFileOptions;
     };
 
-    bool success = true;
+    QStringList filesToFormat;
     if (!options.files().isEmpty()) {
         if (!options.arguments().isEmpty())
             qWarning() << "Warning: Positional arguments are ignored when -F is used";
+        filesToFormat = options.files();
+    } else {
+        filesToFormat = options.arguments();
+    }
 
-        for (const QString &file : options.files()) {
-            Q_ASSERT(!file.isEmpty());
+    // The settings are searched relative to each file and QQmlFormatSettings is not thread-safe,
+    // so we determine the options for all files up front.
+    QList<QQmlFormatOptions> fileOptions;
+    fileOptions.reserve(filesToFormat.size());
+    for (const QString &file : std::as_const(filesToFormat)) {
+        fileOptions.append(getSettings(file, options));
+    }
 
-            if (!parseFile(file, getSettings(file, options)))
-                success = false;
-        }
-    } else {
-        for (const QString &file : options.arguments()) {
-            if (!parseFile(file, getSettings(file, options)))
+    int jobCount = int(std::min<qsizetype>(options.jobs(), filesToFormat.size()));
+    if (jobCount > 1
+        && std::any_of(fileOptions.cbegin(), fileOptions.cend(),
+                       [](const QQmlFormatOptions &o) { return !o.isInplace(); })) {
+        // Formatted files written to stdout from several threads would be interleaved.
+        qWarning() << "Warning: Ignoring -j as parallel formatting requires -i or -F";
+        jobCount = 1;
+    }
+
+    if (jobCount <= 1) {
+        bool success = true;
+        for (qsizetype i = 0; i < filesToFormat.size(); ++i) {
+            if (!parseFile(filesToFormat.at(i), fileOptions.at(i)))
                 success = false;
         }
+        return success ? 0 : 1;
+    }
+
+    // Each file is loaded into its own single-threaded DomEnvironment, so the files can be
+    // formatted independently of each other.
+    const QString *fileData = filesToFormat.constData();
+    const QQmlFormatOptions *optionsData = fileOptions.constData();
+    const qsizetype fileCount = filesToFormat.size();
+    std::atomic<qsizetype> nextFile = 0;
+    std::atomic<bool> success = true;
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int job = 0; job < jobCount; ++job) {
+        threads.emplace_back(QThread::create([&]() {
+            for (qsizetype i = nextFile++; i < fileCount; i = nextFile++) {
+                if (!parseFile(fileData[i], optionsData[i]))
+                    success = false;
+            }
+        }));
+        threads.back()->start();
     }
+    for (const auto &thread : threads)
+        thread->wait();
 
     return success ? 0 : 1;
 }
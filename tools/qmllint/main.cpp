@@ -18,7 +18,11 @@
 #include <QtCore/qjsonobject.h>
 #include <QtCore/qjsonarray.h>
 #include <QtCore/qjsondocument.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qscopeguard.h>
+#include <QtCore/qset.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qwaitcondition.h>
 
 #if QT_CONFIG(commandlineparser)
 #include <QtCore/qcommandlineparser.h>
@@ -26,12 +30,31 @@
 
 #include <QtCore/qlibraryinfo.h>
 
+#include <atomic>
 #include <cstdio>
+#include <memory>
+#include <vector>
 
 using namespace Qt::StringLiterals;
 
 constexpr int JSON_LOGGING_FORMAT_REVISION = 3;
 
+struct LintJob
+{
+    QString filename;
+    QStringList qmlImportPaths;
+    QStringList qmldirFiles;
+    QStringList resourceFiles;
+    QSet<QString> disabledPlugins;
+    QList<QQmlJS::LoggerCategory> categories;
+};
+
+struct LintJobResult
+{
+    QJsonArray json;
+    bool success = true;
+};
+
 bool argumentsFromCommandLineAndFile(QStringList& allArguments, const QStringList &arguments)
 {
     allArguments.reserve(arguments.size());
@@ -199,6 +222,15 @@ All warnings can be set to three levels:
     parser.addOption(maxWarnings);
     settings.addOption("MaxWarnings", -1);
 
+    QCommandLineOption jobsOption(
+            QStringList() << "j"
+                          << "jobs",
+            QLatin1String("Lint up to \"count\" files in parallel. Only supported together with "
+                          "--json or --silent. The output is the same as when linting the files "
+                          "one after another."),
+            QLatin1String("count"), QLatin1String("1"));
+    parser.addOption(jobsOption);
+
     auto addCategory = [&](const QQmlJS::LoggerCategory &category) {
         categories.push_back(category);
         if (category.isDefault())
@@ -332,6 +364,23 @@ All warnings can be set to three levels:
 
     QJsonArray jsonFiles;
 
+    const bool isFixing = parser.isSet(fixFile);
+    bool jobCountOk = false;
+    int jobCount = parser.value(jobsOption).toInt(&jobCountOk);
+    if (!jobCountOk || jobCount <= 0) {
+        qWarning().nospace().noquote() << "Invalid value for --jobs: \"" << parser.value(jobsOption)
+                                       << "\". Expected a positive number.";
+        return 1;
+    }
+    if (jobCount > 1 && (isFixing || (!useJson && !silent))) {
+        qWarning().nospace() << "Ignoring --jobs: Linting files in parallel is only supported "
+                                "together with --json or --silent, and not with --fix.";
+        jobCount = 1;
+    }
+
+    // In parallel mode, we first collect the settings for each file, and lint afterwards.
+    QList<LintJob> jobs;
+
     for (const QString &filename : positionalArguments) {
         if (!parser.isSet(ignoreSettings))
             settings.search(filename);
@@ -407,6 +456,12 @@ All warnings can be set to three levels:
                 disabledPlugins << plugin.toLower();
         }
 
+        if (jobCount > 1) {
+            jobs.append({ filename, qmlImportPaths, qmldirFiles, resourceFiles, disabledPlugins,
+                          categories });
+            continue;
+        }
+
         linter.setPluginsEnabled(!disabledPlugins.contains("all"));
 
         if (!linter.pluginsEnabled())
@@ -417,8 +472,6 @@ All warnings can be set to three levels:
         for (auto &plugin : plugins)
             plugin.setEnabled(!disabledPlugins.contains(plugin.name().toLower()));
 
-        const bool isFixing = parser.isSet(fixFile);
-
         QQmlJSLinter::LintResult lintResult;
 
         if (parser.isSet(moduleOption)) {
@@ -503,6 +556,116 @@ All warnings can be set to three levels:
         }
     }
 
+    if (!jobs.isEmpty()) {
+        const bool lintModules = parser.isSet(moduleOption);
+        const int maxWarningsValue = parser.isSet(maxWarnings)
+                ? parser.value(maxWarnings).toInt()
+                : -1;
+
+        const auto lintJob = [&](QQmlJSLinter *workerLinter, const LintJob &job) {
+            LintJobResult result;
+
+            workerLinter->setPluginsEnabled(!job.disabledPlugins.contains("all"));
+            if (!workerLinter->pluginsEnabled())
+                return result;
+
+            for (auto &plugin : workerLinter->plugins())
+                plugin.setEnabled(!job.disabledPlugins.contains(plugin.name().toLower()));
+
+            // Output from different threads would be interleaved. We only collect the JSON.
+            QQmlJSLinter::LintResult lintResult;
+            if (lintModules) {
+                lintResult = workerLinter->lintModule(
+                        job.filename, true, useJson ? &result.json : nullptr,
+                        job.qmlImportPaths, job.resourceFiles);
+            } else {
+                lintResult = workerLinter->lintFile(
+                        job.filename, nullptr, true, useJson ? &result.json : nullptr,
+                        job.qmlImportPaths, job.qmldirFiles, job.resourceFiles, job.categories);
+            }
+
+            result.success = lintResult == QQmlJSLinter::LintSuccess
+                    || lintResult == QQmlJSLinter::HasWarnings;
+            if (result.success && maxWarningsValue != -1
+                    && maxWarningsValue < workerLinter->logger()->warnings().size()) {
+                result.success = false;
+            }
+            return result;
+        };
+
+        // Each thread gets its own linter, and with it its own import cache, as QQmlJSImporter
+        // is not thread-safe. The linters are created up front, as they load the plugins.
+        std::vector<std::unique_ptr<QQmlJSLinter>> linters;
+        for (qsizetype i = 0, end = std::min<qsizetype>(jobCount, jobs.size()); i < end; ++i) {
+            linters.push_back(std::make_unique<QQmlJSLinter>(
+                    qmlImportPaths, pluginPaths, useAbsolutePath));
+        }
+
+        // The results are stored per file, so that the output is in command line order.
+        QList<LintJobResult> results(jobs.size());
+        LintJobResult *resultData = results.data();
+        const LintJob *jobData = jobs.constData();
+        const qsizetype jobsSize = jobs.size();
+        std::atomic<qsizetype> nextJob = 0;
+
+        // Each importer reports a problem with an imported type for the first file it lints that
+        // uses the type. To get the same output as when linting sequentially, a file only reports
+        // the warnings that none of the files before it on the command line have reported. A job
+        // waits for all earlier jobs before filtering, which cannot dead-lock as the earliest
+        // unfinished job never waits.
+        QMutex globalWarningsMutex;
+        QWaitCondition globalWarningsCondition;
+        QList<bool> finishedJobs(jobsSize, false);
+        qsizetype finishedPrefix = 0;
+        QSet<QString> reportedGlobalWarnings;
+        const auto globalWarningsFilter = [&](qsizetype i) {
+            return [&, i](const QList<QQmlJS::DiagnosticMessage> &warnings) {
+                QMutexLocker locker(&globalWarningsMutex);
+                while (finishedPrefix < i)
+                    globalWarningsCondition.wait(&globalWarningsMutex);
+
+                QList<QQmlJS::DiagnosticMessage> filtered;
+                for (const QQmlJS::DiagnosticMessage &warning : warnings) {
+                    const QString key = QStringLiteral("%1:%2:%3:%4").arg(
+                            QString::number(int(warning.type)),
+                            QString::number(warning.loc.startLine),
+                            QString::number(warning.loc.startColumn), warning.message);
+                    if (!reportedGlobalWarnings.contains(key)) {
+                        reportedGlobalWarnings.insert(key);
+                        filtered.append(warning);
+                    }
+                }
+                return filtered;
+            };
+        };
+
+        std::vector<std::unique_ptr<QThread>> threads;
+        for (const auto &workerLinter : linters) {
+            threads.emplace_back(QThread::create([&, workerLinter = workerLinter.get()]() {
+                for (qsizetype i = nextJob++; i < jobsSize; i = nextJob++) {
+                    workerLinter->setGlobalWarningsFilter(globalWarningsFilter(i));
+                    resultData[i] = lintJob(workerLinter, jobData[i]);
+
+                    QMutexLocker locker(&globalWarningsMutex);
+                    finishedJobs[i] = true;
+                    while (finishedPrefix < jobsSize && finishedJobs[finishedPrefix])
+                        ++finishedPrefix;
+                    globalWarningsCondition.wakeAll();
+                }
+            }));
+            threads.back()->start();
+        }
+
+        for (const auto &thread : threads)
+            thread->wait();
+
+        for (const LintJobResult &result : std::as_const(results)) {
+            success &= result.success;
+            for (const QJsonValue &file : result.json)
+                jsonFiles.append(file);
+        }
+    }
+
     if (useJson) {
         QJsonObject result;
 